@@ -4,6 +4,8 @@
 // https://github.com/numpy/numpy/blob/2ce11750cbdba4d81fa8b3b8856c5b40aee75d45/numpy/core/src/common/npy_argparse.h
 // but edited to fastnumbers needs.
 
+#include <atomic>
+
 #include <Python.h>
 
 /*
@@ -20,13 +22,28 @@
 
 #define FN_MAX_KWARGS 15
 
+/*
+ * The cache is filled in lazily on the first call. On free-threaded builds
+ * several threads may make that first call at the same time, so the fill is
+ * serialized with a mutex and published through `npositional`, which is
+ * written last (with release semantics) and read with acquire semantics.
+ * Any thread that sees a non-negative `npositional` therefore also sees a
+ * completely initialized cache. With the GIL, the mutex is not needed and
+ * the atomic loads and stores compile to plain loads and stores on all
+ * mainstream platforms.
+ */
 typedef struct {
-    int npositional;
+    /* -1 until the cache is initialized - see above */
+    std::atomic<int> npositional;
     int nargs;
     int npositional_only;
     int nrequired;
     /* Null terminated list of keyword argument name strings */
     PyObject* kw_strings[FN_MAX_KWARGS + 1];
+#ifdef Py_GIL_DISABLED
+    /* Serializes initialization of the cache */
+    PyMutex mutex;
+#endif
 } _FNArgParserCache;
 
 /*
@@ -89,7 +106,51 @@ int _fn_parse_arguments(
     ...
 ) noexcept;
 
+/**
+ * Fast path for a call with exactly one positional argument and no keywords.
+ *
+ * This is by far the most common way the scalar functions are called, and
+ * in this case there is nothing to actually parse - the argument belongs to
+ * the first parameter and all other parameters keep their default values
+ * (which are the cached selector objects). This skips the cache
+ * initialization, the argument copying, and the va_list walk entirely.
+ *
+ * The generic parser is used on the first call (to initialize the cache) and
+ * whenever a single positional argument is not a valid call, so that the
+ * proper error is raised.
+ *
+ * @return Returns 0 on success and -1 on failure.
+ */
+template <typename... Rest>
+inline int _fn_parse_single_positional(
+    const char* funcname,
+    _FNArgParserCache* cache,
+    PyObject* const* args,
+    const char* name,
+    bool as_bool,
+    void* data,
+    Rest... rest
+) noexcept
+{
+    if (cache->npositional.load(std::memory_order_acquire) < 1
+        || cache->nrequired > 1) {
+        return _fn_parse_arguments(
+            funcname, cache, args, 1, nullptr, name, as_bool, data, rest...
+        );
+    }
+    if (as_bool) {
+        *((bool*)data) = PyObject_IsTrue(args[0]);
+    } else {
+        *((PyObject**)data) = args[0];
+    }
+    return 0;
+}
+
 #define fn_parse_arguments(funcname, args, len_args, kwnames, ...)                      \
-    _fn_parse_arguments(                                                                \
-        funcname, &__argparse_cache, args, len_args, kwnames, __VA_ARGS__               \
-    )
+    (((kwnames) == nullptr && (len_args) == 1)                                          \
+         ? _fn_parse_single_positional(                                                 \
+               funcname, &__argparse_cache, args, __VA_ARGS__                           \
+           )                                                                            \
+         : _fn_parse_arguments(                                                         \
+               funcname, &__argparse_cache, args, len_args, kwnames, __VA_ARGS__        \
+           ))
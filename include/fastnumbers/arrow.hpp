@@ -0,0 +1,181 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include <Python.h>
+
+#include "fastnumbers/compatibility.hpp"
+#include "fastnumbers/exception.hpp"
+
+// The structures of the Arrow C data interface, copied verbatim from
+// https://arrow.apache.org/docs/format/CDataInterface.html. The guard is
+// the one prescribed by the specification so that the definitions may
+// coexist with those of any Arrow implementation.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+    // Array type description
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowSchema*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+struct ArrowArray {
+    // Array data description
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowArray*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+#endif // ARROW_C_DATA_INTERFACE
+
+/**
+ * \class ArrowStringArray
+ * \brief Read-only access to the cells of an Arrow string array
+ *
+ * The array is obtained from any Python object implementing the
+ * __arrow_c_array__ method of the Arrow PyCapsule interface, so no Arrow
+ * library is needed. Only utf8 and large_utf8 arrays are understood - for
+ * anything else the object is left alone and the ArrowStringArray is empty.
+ */
+class ArrowStringArray {
+public:
+    /**
+     * \brief Import the Arrow array exported by a Python object
+     * \param obj The Python object that might export an Arrow array
+     * \throw exception_is_set If exporting the array raised an exception
+     */
+    explicit ArrowStringArray(PyObject* obj) noexcept(false)
+        : m_array()
+        , m_large(false)
+    {
+        // Like all special methods, this is looked up on the type
+        if (!PyObject_HasAttrString((PyObject*)Py_TYPE(obj), "__arrow_c_array__")) {
+            return;
+        }
+        PyObject* capsules = PyObject_CallMethod(obj, "__arrow_c_array__", nullptr);
+        if (capsules == nullptr) {
+            throw exception_is_set();
+        }
+        if (!PyTuple_Check(capsules) || PyTuple_GET_SIZE(capsules) != 2) {
+            Py_DECREF(capsules);
+            PyErr_SetString(
+                PyExc_TypeError,
+                "__arrow_c_array__ must return a tuple of two PyCapsule objects"
+            );
+            throw exception_is_set();
+        }
+        auto* schema = static_cast<ArrowSchema*>(
+            PyCapsule_GetPointer(PyTuple_GET_ITEM(capsules, 0), "arrow_schema")
+        );
+        auto* array = static_cast<ArrowArray*>(
+            schema == nullptr
+                ? nullptr
+                : PyCapsule_GetPointer(PyTuple_GET_ITEM(capsules, 1), "arrow_array")
+        );
+        if (array == nullptr) {
+            Py_DECREF(capsules);
+            throw exception_is_set();
+        }
+
+        // Move the array out of its capsule so that it outlives the capsule.
+        // The schema is only needed to learn how the buffers are laid out,
+        // and is released along with its capsule.
+        const std::string_view format(schema->format);
+        if (format == "u" || format == "U") {
+            std::memcpy(&m_array, array, sizeof(ArrowArray));
+            array->release = nullptr;
+            m_large = format == "U";
+        }
+        Py_DECREF(capsules);
+    }
+
+    // Copy and assignment are disallowed
+    ArrowStringArray(const ArrowStringArray&) = delete;
+    ArrowStringArray(ArrowStringArray&&) = delete;
+    ArrowStringArray& operator=(const ArrowStringArray&) = delete;
+
+    /// Release the array back to its producer
+    ~ArrowStringArray() noexcept
+    {
+        // The producer might run Python code, which must not see an
+        // exception that is on its way to the user
+        if (m_array.release != nullptr) {
+            PyObject* exc = PyErr_GetRaisedException();
+            m_array.release(&m_array);
+            PyErr_SetRaisedException(exc);
+        }
+    }
+
+    /// Whether or not a string array was imported
+    explicit operator bool() const noexcept { return m_array.release != nullptr; }
+
+    /// The number of cells in the array
+    Py_ssize_t size() const noexcept { return static_cast<Py_ssize_t>(m_array.length); }
+
+    /// Whether or not the cell at the given index is null
+    bool is_null(const Py_ssize_t index) const noexcept
+    {
+        const auto* validity = static_cast<const uint8_t*>(m_array.buffers[0]);
+        if (m_array.null_count == 0 || validity == nullptr) {
+            return false;
+        }
+        const int64_t bit = m_array.offset + index;
+        return ((validity[bit >> 3] >> (bit & 7)) & 1) == 0;
+    }
+
+    /// The UTF-8 text of the (non-null) cell at the given index
+    std::string_view text(const Py_ssize_t index) const noexcept
+    {
+        const int64_t cell = m_array.offset + index;
+        int64_t start = 0;
+        int64_t stop = 0;
+        if (m_large) {
+            const auto* offsets = static_cast<const int64_t*>(m_array.buffers[1]);
+            start = offsets[cell];
+            stop = offsets[cell + 1];
+        } else {
+            const auto* offsets = static_cast<const int32_t*>(m_array.buffers[1]);
+            start = offsets[cell];
+            stop = offsets[cell + 1];
+        }
+        const auto* data = static_cast<const char*>(m_array.buffers[2]);
+        if (data == nullptr) {
+            return std::string_view();
+        }
+        return std::string_view(data + start, static_cast<std::size_t>(stop - start));
+    }
+
+private:
+    /// The imported array, which is released if release is not nullptr
+    ArrowArray m_array;
+
+    /// Whether the offsets are 64-bit (large_utf8) or 32-bit (utf8)
+    bool m_large;
+};
@@ -3,6 +3,8 @@
 #include <cstring>
 #include <limits>
 
+#include <Python.h>
+
 #include "fastnumbers/c_str_parsing.hpp"
 
 /**
@@ -23,6 +25,7 @@ public:
         , m_buffer(nullptr)
         , m_len(needed_length)
         , m_size(0)
+        , m_view()
     {
         reserve(true);
     }
@@ -37,11 +40,16 @@ public:
     Buffer(const Buffer&) = delete;
     Buffer(Buffer&&) = delete;
     Buffer& operator=(const Buffer&) = delete;
-    ~Buffer() noexcept { delete[] m_variable_buffer; };
+    ~Buffer() noexcept
+    {
+        release_view();
+        delete[] m_variable_buffer;
+    };
 
     /// Restore the Buffer to an empty-like state
     void reset() noexcept
     {
+        release_view();
         if (m_variable_buffer == nullptr) {
             m_buffer = m_fixed_buffer;
         } else {
@@ -73,6 +81,34 @@ public:
         copy(data);
     }
 
+    /**
+     * \brief Refer to the data of a Python buffer view instead of copying it
+     *
+     * The view is held until the Buffer is reset or destroyed, so the data
+     * stays valid until then even if it does not belong to the object that
+     * exported it (e.g. a memoryview of a temporary from __buffer__).
+     *
+     * \param view The view, which the Buffer takes ownership of
+     * \return The start of the data of the view
+     */
+    const char* hold(const Py_buffer& view) noexcept
+    {
+        release_view();
+        m_view = view;
+        return static_cast<const char*>(m_view.buf);
+    }
+
+    /// Copy a fixed length of data into the buffer and follow it with
+    /// a nul character, for the Python functions that need one
+    void
+    copy_terminated(const char* data, const std::size_t needed_length) noexcept(false)
+    {
+        reserve(needed_length + 1);
+        m_len = needed_length;
+        copy(data);
+        m_buffer[m_len] = '\0';
+    }
+
     /// Remove underscores that are syntactically valid in a number
     void remove_valid_underscores() noexcept { remove_valid_underscores(false); }
 
@@ -92,7 +128,7 @@ public:
         // then skip the base prefix. If the there was a negative sign, we
         // place it in the position before the first digit after the prefix.
         // Then, the internal buffer pointer is set to point to that new position.
-        const bool is_signed = *m_buffer == '-';
+        const bool is_signed = m_len > 0 && *m_buffer == '-';
         char* tracker = m_buffer;
         std::size_t len = m_len;
         if (is_signed) {
@@ -156,7 +192,19 @@ private:
     /// equal m_len except in intermediate states
     std::size_t m_size;
 
+    /// A view of data that is referred to rather than copied
+    /// (its obj is nullptr if there is no such view)
+    Py_buffer m_view;
+
 private:
+    /// Release the view of data that is referred to, if any
+    void release_view() noexcept
+    {
+        if (m_view.obj != nullptr) {
+            PyBuffer_Release(&m_view); // Also resets obj to NULL
+        }
+    }
+
     /// Set aside the amount of data stored in m_len
     void reserve(const bool force = false) noexcept(false)
     {
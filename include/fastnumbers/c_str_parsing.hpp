@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <charconv>
 #include <cmath>
 #include <cstdint>
@@ -248,6 +249,24 @@ private:
  */
 void remove_valid_underscores(char* str, const char*& end, const bool based) noexcept;
 
+/**
+ * \brief Exactly compare the magnitude of a decimal number with that of a double
+ *
+ * This is slow compared to parsing, and is meant for the rare cases in
+ * which the double that a string was rounded to is not precise enough
+ * to decide a further rounding (e.g. to half precision).
+ *
+ * \param str The string of a valid finite number, with any sign removed
+ *            (it may contain valid underscores)
+ * \param end The end of the string
+ * \param value The finite double to compare against
+ * \return -1, 0, or 1 if the magnitude of the string is less than,
+ *         equal to, or greater than that of the double
+ */
+int compare_magnitude(const char* str, const char* end, const double value) noexcept(
+    false
+);
+
 /**
  * \brief Lowercase a character - does no error checking
  */
@@ -342,6 +361,7 @@ inline void consume_digits(const char*& str, const std::size_t len) noexcept
     // Attempt to read eight characters at a time to determine
     // if they are digits. Loop over the character array in steps
     // of eight. Stop processing if not all eight characters are digits.
+    const char* end = str + len;
     const std::size_t number_of_eights = len / 8;
     for (std::size_t i = 0; i < number_of_eights; ++i) {
         if (fast_float::is_made_of_eight_digits_fast(str)) {
@@ -351,8 +371,9 @@ inline void consume_digits(const char*& str, const std::size_t len) noexcept
         }
     }
 
-    // Read the remainder of digits one-at-a-time.
-    consume_digits(str, str + len);
+    // Read the remainder of digits one-at-a-time, stopping at the end
+    // of the string rather than relying on a terminating non-digit.
+    consume_digits(str, end);
 }
 
 /**
@@ -498,10 +519,10 @@ number_trailing_zeros(const char* start, const char* end) noexcept
  */
 constexpr inline int detect_base(const char* str, const char* end) noexcept
 {
-    if (str[0] == '-') // Skip leading negative sign
+    if (str != end && str[0] == '-') // Skip leading negative sign
         str += 1;
     const std::size_t len = static_cast<std::size_t>(end - str);
-    if (str[0] != '0' || len == 1) {
+    if (len < 2 || str[0] != '0') {
         return 10;
     }
 
@@ -574,7 +595,7 @@ inline T parse_int(
 ) noexcept
 {
     // Remember if we are negative.
-    const bool is_negative = *str == '-';
+    const bool is_negative = str != end && *str == '-';
     const std::size_t negative_offset = static_cast<std::size_t>(is_negative);
     str += negative_offset;
 
@@ -671,6 +692,111 @@ inline T parse_int(
     }
 }
 
+/**
+ * \brief Convert a decimal number into an integer scaled by a power of ten
+ *
+ * For example, "12.34" with a scale of 2 is 1234. The digits and exponent
+ * found by a StringChecker are combined exactly - no floating point
+ * arithmetic is involved. Digits lost by the scaling are truncated,
+ * unless asked to round to nearest (ties to even).
+ *
+ * \param checker The decomposition of the number, assumed to be valid
+ * \param is_negative Whether or not the number is negative
+ * \param scale The power of ten by which to multiply the number
+ * \param inexact Flag to indicate non-zero digits would be lost by the scaling
+ * \param overflow Flag to indicate the scaled number does not fit in T
+ * \param round Round lost digits to nearest instead of truncating them
+ */
+template <typename T, typename std::enable_if_t<std::is_integral_v<T>, bool> = true>
+inline T parse_scaled_int(
+    const StringChecker& checker,
+    const bool is_negative,
+    const int scale,
+    bool& inexact,
+    bool& overflow,
+    const bool round = false
+) noexcept
+{
+    inexact = false;
+    overflow = false;
+
+    // The largest magnitude that fits - negative signed values have one more
+    constexpr unsigned long long max_value
+        = static_cast<unsigned long long>(std::numeric_limits<T>::max());
+    unsigned long long limit = max_value;
+    if (is_negative) {
+        limit = std::is_signed_v<T> ? max_value + 1 : 0ULL;
+    }
+
+    // The number is the integer and decimal digits next to each other, times
+    // ten to the power of the exponent less the number of decimal digits.
+    // Adding the scale gives the power of ten to apply to those digits.
+    const int64_t exponent = checker.is_exponent_negative()
+        ? -static_cast<int64_t>(checker.exponent_value())
+        : static_cast<int64_t>(checker.exponent_value());
+    const int64_t shift = exponent - checker.decimal_length() + scale;
+
+    // A negative shift drops digits from the end. If it drops more digits
+    // than there are, the first dropped digit is an implied leading zero.
+    const int64_t n_digits = checker.digit_length();
+    const int64_t n_kept = shift < 0 ? std::max(n_digits + shift, int64_t(0)) : n_digits;
+    const bool implied_zero = n_digits + shift < 0;
+    unsigned first_dropped = 0U;
+    bool rest_dropped = false;
+
+    unsigned long long value = 0ULL;
+    const uint32_t n_integer = checker.integer_length();
+    for (int64_t i = 0; i < n_digits; ++i) {
+        const char c = i < n_integer ? checker.integer_start()[i]
+                                     : checker.decimal_start()[i - n_integer];
+        const unsigned digit = to_digit<unsigned>(c);
+        if (i >= n_kept) {
+            inexact = inexact || digit != 0;
+            if (i == n_kept && !implied_zero) {
+                first_dropped = digit;
+            } else {
+                rest_dropped = rest_dropped || digit != 0;
+            }
+        } else if (digit > limit || value > (limit - digit) / 10ULL) {
+            overflow = true;
+        } else {
+            value = value * 10ULL + digit;
+        }
+    }
+
+    // Round the magnitude up if the dropped digits are more than half,
+    // or exactly half and the kept digits are odd
+    const bool is_half = first_dropped == 5U && !rest_dropped;
+    const bool over_half = first_dropped > 5U || (first_dropped == 5U && rest_dropped);
+    if (round && !overflow && (over_half || (is_half && (value & 1ULL)))) {
+        if (value == limit) {
+            overflow = true;
+        } else {
+            value += 1ULL;
+        }
+    }
+
+    // A positive shift appends zeros
+    for (int64_t i = 0; i < shift && value != 0 && !overflow; ++i) {
+        if (value > limit / 10ULL) {
+            overflow = true;
+        } else {
+            value *= 10ULL;
+        }
+    }
+
+    if (overflow || value == 0) {
+        return static_cast<T>(0);
+    }
+    if constexpr (std::is_signed_v<T>) {
+        // Negate in the signed type in a way that cannot overflow
+        return is_negative ? static_cast<T>(-static_cast<long long>(value - 1) - 1)
+                           : static_cast<T>(value);
+    } else {
+        return static_cast<T>(value);
+    }
+}
+
 /**
  * \brief Convert a string to a double type
  *
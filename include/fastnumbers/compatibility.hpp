@@ -36,3 +36,37 @@ inline PyObject* PyType_GetName(PyTypeObject* type)
     return type_name(type, nullptr);
 }
 #endif
+
+#if PY_MAJOR_VERSION == 3 && PY_MINOR_VERSION < 12
+// These functions were introduced in Python 3.12 to replace PyErr_Fetch
+// and PyErr_Restore (which are deprecated from then on) by passing around
+// the exception instance alone.
+inline PyObject* PyErr_GetRaisedException()
+{
+    PyObject* type = nullptr;
+    PyObject* value = nullptr;
+    PyObject* traceback = nullptr;
+    PyErr_Fetch(&type, &value, &traceback);
+    if (type == nullptr) {
+        return nullptr;
+    }
+    PyErr_NormalizeException(&type, &value, &traceback);
+    if (traceback != nullptr) {
+        PyException_SetTraceback(value, traceback);
+        Py_DECREF(traceback);
+    }
+    Py_DECREF(type);
+    return value;
+}
+
+inline void PyErr_SetRaisedException(PyObject* exc)
+{
+    if (exc == nullptr) {
+        PyErr_Clear();
+        return;
+    }
+    PyObject* type = (PyObject*)Py_TYPE(exc);
+    Py_INCREF(type);
+    PyErr_Restore(type, exc, PyException_GetTraceback(exc));
+}
+#endif
@@ -1,16 +1,21 @@
 #pragma once
 
 #include <cmath>
+#include <cstddef>
+#include <limits>
 #include <map>
+#include <optional>
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <Python.h>
 
 #include "fastnumbers/compatibility.hpp"
 #include "fastnumbers/exception.hpp"
 #include "fastnumbers/extractor.hpp"
+#include "fastnumbers/half.hpp"
 #include "fastnumbers/helpers.hpp"
 #include "fastnumbers/introspection.hpp"
 #include "fastnumbers/parser.hpp"
@@ -18,6 +23,111 @@
 #include "fastnumbers/selectors.hpp"
 #include "fastnumbers/user_options.hpp"
 
+/**
+ * \brief The C type the parsers produce on the way to a value of type T
+ *
+ * The parsers only know about the fundamental integer and floating point
+ * types. Other output types are parsed as a wider type and then narrowed.
+ */
+template <typename T>
+struct parse_type {
+    using type = T;
+};
+
+template <>
+struct parse_type<bool> {
+    using type = unsigned char;
+};
+
+template <>
+struct parse_type<Half> {
+    using type = double;
+};
+
+/**
+ * \brief Narrow a number parsed as the type given by parse_type into type T
+ *
+ * Booleans only accept 0 and 1 - anything else is an overflow.
+ * Half precision values are rounded from a double (see also parse_as()).
+ */
+template <typename T>
+RawPayload<T> narrow_as(const RawPayload<typename parse_type<T>::type>& payload) noexcept
+{
+    using P = typename parse_type<T>::type;
+    if constexpr (std::is_same_v<T, P>) {
+        return payload;
+    } else {
+        if (const ErrorType* err = std::get_if<ErrorType>(&payload)) {
+            return *err;
+        }
+        const P value = std::get<P>(payload);
+        if constexpr (std::is_same_v<T, bool>) {
+            if (value > 1) {
+                return ErrorType::OVERFLOW_;
+            }
+            return value != 0;
+        } else {
+            return T(value);
+        }
+    }
+}
+
+/// Parse a number of type T using the given parser
+template <typename T, typename Parser>
+RawPayload<T> parse_as(const Parser& parser) noexcept(false)
+{
+    RawPayload<typename parse_type<T>::type> payload;
+    parser.as_number(payload);
+    if constexpr (std::is_same_v<typename parse_type<T>::type, T>) {
+        return payload;
+    } else {
+        // Text is parsed to a double first, which loses the information needed
+        // to round correctly when that double lies exactly halfway between two
+        // halves
+        if constexpr (std::is_same_v<T, Half>
+                      && std::is_same_v<Parser, CharacterParser>) {
+            const double* value = std::get_if<double>(&payload);
+            if (value != nullptr && Half::is_halfway(*value)) {
+                return Half(*value, parser.compare_magnitude(*value));
+            }
+        }
+        return narrow_as<T>(payload);
+    }
+}
+
+/**
+ * \brief Parse a number of integral type T using the given parser, converting
+ *        a float according to the float-to-int mode given in the options
+ */
+template <typename T, typename Parser>
+RawPayload<T> parse_rounded_as(const Parser& parser) noexcept(false)
+{
+    using P = typename parse_type<T>::type;
+    return narrow_as<T>(parser.template as_rounded_number<P>());
+}
+
+/// Whether or not a floating point value is NaN
+template <typename T>
+inline bool value_is_nan(const T value) noexcept
+{
+    if constexpr (std::is_same_v<T, Half>) {
+        return value.is_nan();
+    } else {
+        return std::isnan(value);
+    }
+}
+
+/// Whether or not a floating point value is infinity
+template <typename T>
+inline bool value_is_inf(const T value) noexcept
+{
+    if constexpr (std::is_same_v<T, Half>) {
+        return value.is_inf();
+    } else {
+        return std::isinf(value);
+    }
+}
+
 /**
  * \class CTypeExtractor
  * \brief Extract the requested C numeric type from a Python object
@@ -32,8 +142,14 @@ public:
         , m_fail()
         , m_overflow()
         , m_type_error()
+        , m_clamp(false)
+        , m_flagged(false)
+        , m_fail_batched(false)
+        , m_deferred(false)
+        , m_deferred_inputs(nullptr)
+        , m_deferred_locations()
         , m_options(options)
-        , m_buffer()
+        , m_dispatch()
     { }
 
     // Copy and assignment are disallowed
@@ -41,8 +157,8 @@ public:
     CTypeExtractor(CTypeExtractor&&) = delete;
     CTypeExtractor& operator=(const CTypeExtractor&) = delete;
 
-    // Default destructor
-    ~CTypeExtractor() = default;
+    /// Destructor releases any inputs still waiting for a batch
+    ~CTypeExtractor() noexcept { Py_XDECREF(m_deferred_inputs); }
 
     /**
      * \brief Return a C number in the requested type
@@ -52,24 +168,45 @@ public:
      */
     T extract_c_number(PyObject* input) noexcept(false)
     {
-        // Get the payload no matter which parser was returned
+        m_flagged = false;
+        m_deferred = false;
+
+        // Exact Python ints are the most common input, so read their value
+        // directly rather than classifying them with a NumericParser.
+        // Anything that does not simply fit takes the general route below.
+        long long int_value = 0;
+        if (PyLong_CheckExact(input) && casts_from<long long>()
+            && exact_int_value(input, int_value) && can_cast(int_value)) {
+            return cast(int_value);
+        }
+
+        // Get the payload no matter which parser is used
         RawPayload<T> payload;
-        std::visit(
-            [&payload](const auto& parser) {
-                parser.as_number(payload);
-            },
-            extract_parser(input, m_buffer, m_options)
+        bool is_negative = false;
+        m_dispatch(
+            input,
+            m_options,
+            [this, &payload, &is_negative](const auto& parser) {
+                parse_payload(parser, payload);
+
+                // Only clamping an overflow needs to know the sign
+                const ErrorType* err = std::get_if<ErrorType>(&payload);
+                if (m_clamp && err != nullptr && *err == ErrorType::OVERFLOW_) {
+                    is_negative = parsed_is_negative(parser);
+                }
+            }
         );
 
         // Function to pass-through a valid value, handling the special
         // case of the value being NaN or INF and requiring a replacement.
         auto handle_value = [&](const T value) -> T {
-            if constexpr (std::is_floating_point_v<T>) {
+            if constexpr (std::is_floating_point_v<T> || std::is_same_v<T, Half>) {
                 const bool replace_nan = !std::holds_alternative<std::monostate>(m_nan);
                 const bool replace_inf = !std::holds_alternative<std::monostate>(m_inf);
-                if (std::isnan(value) && replace_nan) {
+                m_flagged = value_is_nan(value);
+                if (m_flagged && replace_nan) {
                     return replace_value(ReplaceType::NAN_, input);
-                } else if (std::isinf(value) && replace_inf) {
+                } else if (value_is_inf(value) && replace_inf) {
                     return replace_value(ReplaceType::INF_, input);
                 }
             }
@@ -77,10 +214,19 @@ public:
         };
 
         // Function to call the appropriate error handler if an error occured.
-        auto handle_error = [this, input](const ErrorType err) -> T {
+        auto handle_error = [this, input, is_negative](const ErrorType err) -> T {
+            m_flagged = true;
             if (err == ErrorType::BAD_VALUE) {
+                if (may_defer()) {
+                    defer(input);
+                    return T();
+                }
                 return replace_value(ReplaceType::FAIL_, input);
             } else if (err == ErrorType::OVERFLOW_) {
+                if (m_clamp) {
+                    return is_negative ? std::numeric_limits<T>::lowest()
+                                       : std::numeric_limits<T>::max();
+                }
                 return replace_value(ReplaceType::OVERFLOW_, input);
             } else {
                 return replace_value(ReplaceType::TYPE_ERROR_, input);
@@ -91,6 +237,228 @@ public:
         return std::visit(overloaded { handle_value, handle_error }, payload);
     }
 
+    /**
+     * \brief Return a C number in the requested type from UTF-8 text
+     *
+     * ASCII text is parsed directly without creating a Python object. Only if
+     * the text is not ASCII, or if the number needs the Python object for an
+     * error message or replacement, is a Python str created and converted.
+     *
+     * \param str The UTF-8 text, which need not be nul-terminated
+     * \param len The length of the text in bytes
+     * \return The C number in the template type specified
+     * \throw exception_is_set If a Python exception is set and needs to be raised
+     */
+    T extract_c_number(const char* str, const std::size_t len) noexcept(false)
+    {
+        if (const auto value = extract_c_number_in_place(str, len)) {
+            return *value;
+        }
+
+        // Otherwise convert as a Python str, which handles everything else
+        PyObject* input
+            = PyUnicode_DecodeUTF8(str, static_cast<Py_ssize_t>(len), "strict");
+        if (input == nullptr) {
+            throw exception_is_set();
+        }
+        try {
+            const T value = extract_c_number(input);
+            Py_DECREF(input);
+            return value;
+        } catch (...) {
+            Py_DECREF(input);
+            throw;
+        }
+    }
+
+    /**
+     * \brief Return a C number from UTF-8 text if that needs no Python at all
+     *
+     * This is the part of extract_c_number() that does not call into Python,
+     * so it may be used while holding a lock that Python code might want.
+     *
+     * \param str The UTF-8 text, which need not be nul-terminated
+     * \param len The length of the text in bytes
+     * \return The C number, or std::nullopt if the text is not ASCII or the
+     *         number must be replaced (in which case extract_c_number() is
+     *         needed)
+     */
+    std::optional<T> extract_c_number_in_place(const char* str, const std::size_t len)
+        noexcept(false)
+    {
+        m_flagged = false;
+        m_deferred = false;
+        if (!is_ascii(str, len)) {
+            return std::nullopt;
+        }
+        RawPayload<T> payload;
+        parse_payload(CharacterParser(str, len, m_options), payload);
+        const T* value = std::get_if<T>(&payload);
+        if (value == nullptr) {
+            return std::nullopt;
+        }
+        if constexpr (std::is_floating_point_v<T> || std::is_same_v<T, Half>) {
+            const bool is_nan = value_is_nan(*value);
+            const bool replace_nan
+                = is_nan && !std::holds_alternative<std::monostate>(m_nan);
+            const bool replace_inf = !is_nan && value_is_inf(*value)
+                && !std::holds_alternative<std::monostate>(m_inf);
+            if (replace_nan || replace_inf) {
+                return std::nullopt;
+            }
+            m_flagged = is_nan;
+        }
+        return *value;
+    }
+
+    /**
+     * \brief Whether C numbers of type S may ever be cast directly into T
+     *
+     * Scaled integers are never cast directly, nor are floats into an
+     * integer unless a float-to-int mode other than "raise" was chosen.
+     *
+     * \see can_cast()
+     */
+    template <typename S>
+    bool casts_from() const noexcept
+    {
+        if constexpr (std::is_integral_v<T>) {
+            if (m_options.is_scaled()) {
+                return false;
+            }
+            if constexpr (std::is_floating_point_v<S>) {
+                return m_options.float_to_int() != FloatToInt::RAISE;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * \brief Whether a C number can be converted with cast() rather than
+     *        as the Python int or float it represents
+     *
+     * This is the case when the number fits in T and would be neither
+     * replaced nor flagged - that is, when extract_c_number() would simply
+     * have returned the value. The check has no branches, so checking a
+     * run of numbers at a time can be vectorized by the compiler.
+     *
+     * \param value The number of the integral or floating point type S
+     */
+    template <typename S>
+    bool can_cast(const S value) const noexcept
+    {
+        if constexpr (std::is_integral_v<T> && std::is_floating_point_v<S>) {
+            using P = typename parse_type<T>::type;
+            const double rounded = round_to_int(value);
+            const bool exact = m_options.float_to_int() != FloatToInt::INTLIKE
+                || rounded == static_cast<double>(value);
+            using Limits = std::numeric_limits<P>;
+            const double upper = static_cast<double>(Limits::max()) + 1.0;
+            const double lower = static_cast<double>(Limits::min());
+            if constexpr (std::is_same_v<T, bool>) {
+                return exact & ((rounded == 0.0) | (rounded == 1.0));
+            } else {
+                // NaN and infinity fail the comparisons
+                return exact & (rounded >= lower) & (rounded < upper);
+            }
+        } else if constexpr (std::is_integral_v<T>) {
+            return integer_fits(value);
+        } else if constexpr (std::is_integral_v<S>) {
+            // Any integer fits in a float or double, but not in a half
+            return !value_is_inf(cast(value));
+        } else {
+            return std::isfinite(value) & !value_is_inf(cast(value));
+        }
+    }
+
+    /**
+     * \brief Convert a C number for which can_cast() is true
+     * \param value The number of the integral or floating point type S
+     */
+    template <typename S>
+    T cast(const S value) const noexcept
+    {
+        if constexpr (std::is_integral_v<T> && std::is_floating_point_v<S>) {
+            return static_cast<T>(round_to_int(value));
+        } else if constexpr (std::is_same_v<T, Half>) {
+            return T(static_cast<double>(value));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            // Like a Python number, go through a double
+            return static_cast<T>(static_cast<double>(value));
+        } else {
+            return static_cast<T>(value);
+        }
+    }
+
+    /// Whether the last extracted number failed, overflowed, had the wrong
+    /// type, or was NaN (regardless of any replacement that was made)
+    bool flagged() const noexcept { return m_flagged; }
+
+    /// Whether the last extracted number failed and its replacement is
+    /// waiting for a batched callable - see defer_to()
+    bool deferred() const noexcept { return m_deferred; }
+
+    /// Whether any number might be deferred, i.e. whether a batched callable
+    /// was given for conversion failure
+    bool may_defer() const noexcept
+    {
+        return m_fail_batched && std::holds_alternative<PyObject*>(m_fail);
+    }
+
+    /// Define whether a callable given for conversion failure accepts a list
+    /// of inputs, in which case failures are deferred and resolved in batches
+    void set_fail_batched(const bool batched) noexcept { m_fail_batched = batched; }
+
+    /**
+     * \brief Record where the replacement of the last (deferred) number belongs
+     *
+     * When enough numbers have been deferred the batch is resolved.
+     *
+     * \param location The memory into which to write the replacement
+     * \throw exception_is_set If a Python exception is set and needs to be raised
+     */
+    void defer_to(T* location) noexcept(false)
+    {
+        m_deferred_locations.push_back(location);
+        if (m_deferred_locations.size() == FAIL_BATCH_SIZE) {
+            resolve_deferred();
+        }
+    }
+
+    /**
+     * \brief Call the batched callable for all deferred numbers, then write
+     *        each replacement where it belongs
+     * \throw exception_is_set If a Python exception is set and needs to be raised
+     */
+    void resolve_deferred() noexcept(false)
+    {
+        if (m_deferred_locations.empty()) {
+            return;
+        }
+        PyObject* callable = std::get<PyObject*>(m_fail);
+        PyObject* replacements = call_batched_callable(callable, m_deferred_inputs);
+        if (replacements == nullptr) {
+            throw exception_is_set();
+        }
+        try {
+            PyObject** items = PySequence_Fast_ITEMS(replacements);
+            for (std::size_t i = 0; i < m_deferred_locations.size(); ++i) {
+                PyObject* input = PyList_GET_ITEM(m_deferred_inputs, i);
+                Py_INCREF(items[i]);
+                *m_deferred_locations[i]
+                    = convert_python_result(items[i], input, ReplaceType::FAIL_);
+            }
+        } catch (...) {
+            Py_DECREF(replacements);
+            throw;
+        }
+        Py_DECREF(replacements);
+        m_deferred_locations.clear();
+
+        // The callable may have kept the list, so start a new one next time
+        Py_CLEAR(m_deferred_inputs);
+    }
+
     /**
      * \brief Define if the value needs to be replaced if NaN would be returned
      * \param replacement The Python object to use to replace the value
@@ -128,7 +496,10 @@ public:
      */
     void set_overflow_replacement(PyObject* replacement) noexcept(false)
     {
-        add_replacement_to_mapping(ReplaceType::OVERFLOW_, replacement);
+        m_clamp = replacement == Selectors::CLAMP;
+        if (!m_clamp) {
+            add_replacement_to_mapping(ReplaceType::OVERFLOW_, replacement);
+        }
     }
 
     /**
@@ -169,6 +540,24 @@ private:
     /// Potential replacement for invalid types
     ReplaceValue m_type_error;
 
+    /// Whether or not overflows saturate to the limits of the type
+    bool m_clamp;
+
+    /// Whether or not the last extracted number was an error or NaN
+    bool m_flagged;
+
+    /// Whether or not the callable for conversion failure accepts a list of inputs
+    bool m_fail_batched;
+
+    /// Whether or not the last extracted number was deferred to a batch
+    bool m_deferred;
+
+    /// The inputs deferred to the next batch (nullptr until the first)
+    PyObject* m_deferred_inputs;
+
+    /// Where the replacement for each deferred input belongs
+    std::vector<T*> m_deferred_locations;
+
     /// Store string representations of the replacement types
     const std::map<ReplaceType, const char*> m_replace_repr {
         { ReplaceType::INF_, "inf" },
@@ -181,10 +570,133 @@ private:
     /// Hold the evaluator options
     UserOptions m_options;
 
-    /// A buffer into which to store text data
-    Buffer m_buffer;
+    /// Chooses the parser for each input, once per run of a type
+    ParserDispatch m_dispatch;
 
 private:
+    /// Parse the number of type T from the given parser into the payload
+    template <typename Parser>
+    void parse_payload(const Parser& parser, RawPayload<T>& payload) const
+        noexcept(false)
+    {
+        if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+            if (m_options.is_scaled()) {
+                payload = parser.template as_scaled_number<T>();
+                return;
+            }
+        }
+        // Types the parsers know are parsed straight into the payload
+        if constexpr (std::is_same_v<typename parse_type<T>::type, T>) {
+            parser.as_number(payload);
+        } else {
+            payload = parse_as<T>(parser);
+        }
+
+        // A float is only invalid for an integer if asked to be.
+        // Any negative string overflows an unsigned integer, but a
+        // negative float might still truncate or round to zero.
+        if constexpr (std::is_integral_v<T>) {
+            if (m_options.float_to_int() == FloatToInt::RAISE) {
+                return;
+            }
+            using P = typename parse_type<T>::type;
+            const ErrorType* err = std::get_if<ErrorType>(&payload);
+            const bool retry = err != nullptr
+                && (*err == ErrorType::BAD_VALUE
+                    || (std::is_unsigned_v<P> && *err == ErrorType::OVERFLOW_));
+            if (retry) {
+                payload = parse_rounded_as<T>(parser);
+            }
+        }
+    }
+
+    /// Round a float to an integer as the float-to-int mode says (if the mode
+    /// is "intlike" it is truncated, and must then be compared to the float)
+    template <typename S>
+    double round_to_int(const S value) const noexcept
+    {
+        if (m_options.float_to_int() == FloatToInt::ROUND) {
+            return std::nearbyint(static_cast<double>(value)); // ties to even
+        }
+        return std::trunc(static_cast<double>(value));
+    }
+
+    /// Whether or not an integer is within the range of the integral type T
+    template <typename S>
+    static bool integer_fits(const S value) noexcept
+    {
+        using Limits = std::numeric_limits<T>;
+        if constexpr (std::is_same_v<T, bool>) {
+            return (value == 0) | (value == 1);
+        } else if constexpr (std::is_signed_v<S> == std::is_signed_v<T>) {
+            return (value >= Limits::min()) & (value <= Limits::max());
+        } else if constexpr (std::is_signed_v<S>) {
+            using U = std::make_unsigned_t<S>;
+            return (value >= 0) & (static_cast<U>(value) <= Limits::max());
+        } else {
+            using U = std::make_unsigned_t<T>;
+            return value <= static_cast<U>(Limits::max());
+        }
+    }
+
+    /**
+     * \brief Read the value of an exact Python int if it fits in a long long
+     * \param input The exact Python int
+     * \param value The value of the int, if it fits
+     * \return Whether or not the int fit
+     */
+    static bool exact_int_value(PyObject* input, long long& value) noexcept
+    {
+#if PY_VERSION_HEX >= 0x030C0000
+        // Ints of a single digit are stored inline
+        auto* number = reinterpret_cast<PyLongObject*>(input);
+        if (PyUnstable_Long_IsCompact(number)) {
+            value = static_cast<long long>(PyUnstable_Long_CompactValue(number));
+            return true;
+        }
+#endif
+        // An exact int cannot raise, it can only overflow
+        int overflow = 0;
+        value = PyLong_AsLongLongAndOverflow(input, &overflow);
+        return overflow == 0;
+    }
+
+    /// Whether or not all the given characters are ASCII
+    static bool is_ascii(const char* str, const std::size_t len) noexcept
+    {
+        for (std::size_t i = 0; i < len; ++i) {
+            if (static_cast<unsigned char>(str[i]) & 0x80U) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Whether or not the number held by the given parser is negative
+    template <typename Parser>
+    static bool parsed_is_negative(const Parser& parser) noexcept
+    {
+        if constexpr (std::is_same_v<Parser, NumericParser>) {
+            return parser.is_negative_number();
+        } else {
+            return parser.is_negative();
+        }
+    }
+
+    /// Save the input of a failure that is to be resolved in a batch
+    void defer(PyObject* input) noexcept(false)
+    {
+        if (m_deferred_inputs == nullptr) {
+            if ((m_deferred_inputs = PyList_New(0)) == nullptr) {
+                throw exception_is_set();
+            }
+        }
+        if (PyList_Append(m_deferred_inputs, input) != 0) {
+            throw exception_is_set();
+        }
+        m_deferred = true;
+    }
+
     /// Return the object that corresponds to the user's requested key -
     /// the return is a reference so it can be edited
     ReplaceValue& get_value(ReplaceType key) noexcept
@@ -342,7 +854,7 @@ private:
         // For anything else, assume it was a number and convert to a value
         // of the appropriate type and store in the mapping.
         const NumericParser parser(replacement, m_options);
-        std::visit(overloaded { handle_value, handle_error }, parser.as_number<T>());
+        std::visit(overloaded { handle_value, handle_error }, parse_as<T>(parser));
     }
 
     /**
@@ -366,7 +878,20 @@ private:
         if (retval == nullptr) {
             throw exception_is_set();
         }
+        return convert_python_result(retval, input, key);
+    }
 
+    /**
+     * \brief Convert the value returned by a python callable into a C-type
+     * \param retval The value returned by the callable, which is stolen
+     * \param input The Python object that was given to the callable
+     * \param key The key describing which callable was invoked
+     * \return A C-type of what was returned from the callable
+     * \throws exception_is_set
+     */
+    T convert_python_result(PyObject* retval, PyObject* input, const ReplaceType key)
+        const
+    {
         // Function to raise an exception on conversion error, then decrease
         // the reference count of the Python object returned from the callable.
         auto handle_call_value_error = [&](const ErrorType err) -> T {
@@ -421,7 +946,7 @@ private:
                 },
                 handle_call_value_error,
             },
-            parser.as_number<T>()
+            parse_as<T>(parser)
         );
     }
 };
@@ -7,7 +7,7 @@ PyDoc_STRVAR(fastnumbers__doc__, "Quickly convert strings to numbers.\n");
 PyDoc_STRVAR(
     try_real__doc__,
     "try_real(x, *, inf=fastnumbers.ALLOWED, nan=fastnumbers.ALLOWED, "
-    "on_fail=fastnumbers.INPUT, on_type_error=fastnumbers.RAISE, "
+    "on_fail=fastnumbers.INPUT, batch_on_fail=False, on_type_error=fastnumbers.RAISE, "
     "coerce=True, allow_underscores=False, map=False)\n"
     "Quickly convert input to an *int* or *float* depending on value.\n"
     "\n"
@@ -40,7 +40,14 @@ PyDoc_STRVAR(
     "    as-is. Other valid values are *RAISE* to indicate a *ValueError* should\n"
     "    be raised, a callable accepting a single argument that will be called with\n"
     "    the input to return an alternate value, or a default value to be returned\n"
-    "    instead of the input.\n"
+    "    instead of the input. If *map* is *True* or *list*, *SKIP* may be given to\n"
+    "    leave the element out of the result entirely.\n"
+    "batch_on_fail : bool, optional\n"
+    "    If *True* and `on_fail` is a callable, the callable is given a *list* of\n"
+    "    failing inputs and must return a sequence with one replacement per input.\n"
+    "    If *map* is *list*, failures are collected and given to the callable in\n"
+    "    chunks, so it is called far less often than once per failure. The default\n"
+    "    is *False*.\n"
     "on_type_error : optional\n"
     "    Control what happens when the input is neither numeric nor string. Behavior\n"
     "    matches that of `on_fail` except that the default value is *RAISE* and a\n"
@@ -132,7 +139,7 @@ PyDoc_STRVAR(
 PyDoc_STRVAR(
     try_float__doc__,
     "try_float(x, *, inf=fastnumbers.ALLOWED, nan=fastnumbers.ALLOWED, "
-    "on_fail=fastnumbers.INPUT, on_type_error=fastnumbers.RAISE, "
+    "on_fail=fastnumbers.INPUT, batch_on_fail=False, on_type_error=fastnumbers.RAISE, "
     "allow_underscores=False, map=False)\n"
     "Quickly convert input to a *float*.\n"
     "\n"
@@ -165,7 +172,14 @@ PyDoc_STRVAR(
     "    as-is. Other valid values are *RAISE* to indicate a *ValueError* should\n"
     "    be raised, a callable accepting a single argument that will be called with\n"
     "    the input to return an alternate value, or a default value to be returned\n"
-    "    instead of the input.\n"
+    "    instead of the input. If *map* is *True* or *list*, *SKIP* may be given to\n"
+    "    leave the element out of the result entirely.\n"
+    "batch_on_fail : bool, optional\n"
+    "    If *True* and `on_fail` is a callable, the callable is given a *list* of\n"
+    "    failing inputs and must return a sequence with one replacement per input.\n"
+    "    If *map* is *list*, failures are collected and given to the callable in\n"
+    "    chunks, so it is called far less often than once per failure. The default\n"
+    "    is *False*.\n"
     "on_type_error : optional\n"
     "    Control what happens when the input is neither numeric nor string. Behavior\n"
     "    matches that of `on_fail` except that the default value is *RAISE* and a\n"
@@ -236,13 +250,16 @@ PyDoc_STRVAR(
     "    7\n"
     "    >>> try_float(['56.0', '56.07'], map=list)\n"
     "    [56.0, 56.07]\n"
+    "    >>> from fastnumbers import SKIP\n"
+    "    >>> try_float(['56.0', 'invalid', '56.07'], on_fail=SKIP, map=list)\n"
+    "    [56.0, 56.07]\n"
     "\n"
 );
 
 PyDoc_STRVAR(
     try_int__doc__,
-    "try_int(x, *, on_fail=fastnumbers.INPUT, on_type_error=fastnumbers.RAISE, "
-    "base=10, allow_underscores=False, map=False)\n"
+    "try_int(x, *, on_fail=fastnumbers.INPUT, batch_on_fail=False, "
+    "on_type_error=fastnumbers.RAISE, base=10, allow_underscores=False, map=False)\n"
     "Quickly convert input to an *int*.\n"
     "\n"
     "Any input that is valid for the built-in *int*\n"
@@ -263,7 +280,14 @@ PyDoc_STRVAR(
     "    as-is. Other valid values are *RAISE* to indicate a *ValueError* should\n"
     "    be raised, a callable accepting a single argument that will be called with\n"
     "    the input to return an alternate value, or a default value to be returned\n"
-    "    instead of the input.\n"
+    "    instead of the input. If *map* is *True* or *list*, *SKIP* may be given to\n"
+    "    leave the element out of the result entirely.\n"
+    "batch_on_fail : bool, optional\n"
+    "    If *True* and `on_fail` is a callable, the callable is given a *list* of\n"
+    "    failing inputs and must return a sequence with one replacement per input.\n"
+    "    If *map* is *list*, failures are collected and given to the callable in\n"
+    "    chunks, so it is called far less often than once per failure. The default\n"
+    "    is *False*.\n"
     "on_type_error : optional\n"
     "    Control what happens when the input is neither numeric nor string. Behavior\n"
     "    matches that of `on_fail` except that the default value is *RAISE* and a\n"
@@ -343,9 +367,121 @@ PyDoc_STRVAR(
 );
 
 PyDoc_STRVAR(
-    try_forceint__doc__,
-    "try_forceint(x, *, on_fail=fastnumbers.INPUT, on_type_error=fastnumbers.RAISE, "
+    try_scaled_int__doc__,
+    "try_scaled_int(x, scale, *, on_fail=fastnumbers.INPUT, batch_on_fail=False, "
+    "on_overflow=fastnumbers.INPUT, on_type_error=fastnumbers.RAISE, "
     "allow_underscores=False, map=False)\n"
+    "Quickly convert input to an *int* scaled by a power of ten.\n"
+    "\n"
+    "The input is multiplied by ``10 ** scale`` exactly, so '12.34' with a\n"
+    "scale of 2 is converted to `1234`. This is a fixed-point representation\n"
+    "suitable for e.g. currency. No floating point arithmetic is involved, so\n"
+    "there is no rounding. A *float* input is scaled exactly from its shortest\n"
+    "representation (e.g. 0.1 is treated as '0.1').\n"
+    "\n"
+    "The result must fit in a signed 64-bit integer, and no non-zero digits\n"
+    "may be lost by the scaling.\n"
+    "\n"
+    "Parameters\n"
+    "----------\n"
+    "input : {str, float, int} or iterable of {str, float, int}\n"
+    "    The input you wish to convert to a scaled *int* - must be an iterable\n"
+    "    of inputs if *map* is not *False*.\n"
+    "scale : int\n"
+    "    The power of ten by which to multiply the input. May be negative.\n"
+    "on_fail : optional\n"
+    "    Control what happens when an input string cannot be converted to a\n"
+    "    scaled *int*, including when non-zero digits would be lost (e.g.\n"
+    "    '12.345' with a scale of 2). The default is *INPUT* which indicates\n"
+    "    that the value should be returned as-is. Other valid values are *RAISE*\n"
+    "    to indicate a *ValueError* should be raised, a callable accepting a\n"
+    "    single argument that will be called with the input to return an\n"
+    "    alternate value, or a default value to be returned instead of the input.\n"
+    "    If *map* is *True* or *list*, *SKIP* may be given to leave the element\n"
+    "    out of the result entirely.\n"
+    "batch_on_fail : bool, optional\n"
+    "    If *True* and `on_fail` is a callable, the callable is given a *list* of\n"
+    "    failing inputs and must return a sequence with one replacement per input.\n"
+    "    If *map* is *list*, failures are collected and given to the callable in\n"
+    "    chunks, so it is called far less often than once per failure. The default\n"
+    "    is *False*.\n"
+    "on_overflow : optional\n"
+    "    Control what happens when the scaled input does not fit in a signed\n"
+    "    64-bit integer. Behavior matches that of `on_fail` except that an\n"
+    "    *OverflowError* is raised instead of *ValueError*.\n"
+    "on_type_error : optional\n"
+    "    Control what happens when the input is neither numeric nor string. Behavior\n"
+    "    matches that of `on_fail` except that the default value is *RAISE* and a\n"
+    "    *TypeError* is raised instead of *ValueError*.\n"
+    "allow_underscores : bool, optional\n"
+    "    Underscores are allowed in numeric literals and in strings passed to *int*\n"
+    "    or *float* (see PEP 515 for details on what is and is not allowed). You can\n"
+    "    enable that behavior by setting this option to *True* - the default is\n"
+    "    *False*.\n"
+    "map : bool or type(list), optional\n"
+    "    If *True* or *list*, instead of accepting a single value to convert this\n"
+    "    function accepts an iterable of values to convert. If *True* it returns\n"
+    "    an iterable of the results, and if *list* it returns a *list* of\n"
+    "    the results. The default is *False*.\n"
+    "\n"
+    "Returns\n"
+    "-------\n"
+    "out : {str, int} or list of {str, int}\n"
+    "    If the input could be converted to a scaled *int*, the return type will\n"
+    "    be *int*. Otherwise, the return value can be manipulated.\n"
+    "    by the value of `on_fail`, `on_overflow`, or `on_type_error`.\n"
+    "    If *map* is *True*, then the output will be an iterator of these things.\n"
+    "    If *map* is *list*, then the output will be a *list* of these things.\n"
+    "\n"
+    "Raises\n"
+    "------\n"
+    "TypeError\n"
+    "    If the input is not one of *str*, *float*, or *int* and `on_type_error` is\n"
+    "    set to *RAISE*.\n"
+    "ValueError\n"
+    "    If `on_fail` is set to *RAISE* and a triggering event is set.\n"
+    "OverflowError\n"
+    "    If `on_overflow` is set to *RAISE* and a triggering event is set.\n"
+    "\n"
+    "See Also\n"
+    "--------\n"
+    "try_int\n"
+    "try_array\n"
+    "\n"
+    "Examples\n"
+    "--------\n"
+    "\n"
+    "    >>> from fastnumbers import RAISE, try_scaled_int\n"
+    "    >>> try_scaled_int('12.34', 2)\n"
+    "    1234\n"
+    "    >>> try_scaled_int('-0.5', 2)\n"
+    "    -50\n"
+    "    >>> try_scaled_int('1.5e3', 2)\n"
+    "    150000\n"
+    "    >>> try_scaled_int(0.1, 2)\n"
+    "    10\n"
+    "    >>> try_scaled_int(12, 2)\n"
+    "    1200\n"
+    "    >>> try_scaled_int('1200', -2)\n"
+    "    12\n"
+    "    >>> try_scaled_int('12.345', 2)\n"
+    "    '12.345'\n"
+    "    >>> try_scaled_int('12.345', 2, on_fail=RAISE) #doctest: "
+    "+IGNORE_EXCEPTION_DETAIL\n"
+    "    Traceback (most recent call last):\n"
+    "      ...\n"
+    "    ValueError: could not convert '12.345' to an integer with scale 2\n"
+    "    >>> try_scaled_int('1e30', 2, on_overflow=-1)\n"
+    "    -1\n"
+    "    >>> try_scaled_int(['1.10', '2.2', 'bad'], 2, map=list)\n"
+    "    [110, 220, 'bad']\n"
+    "\n"
+);
+
+PyDoc_STRVAR(
+    try_forceint__doc__,
+    "try_forceint(x, *, on_fail=fastnumbers.INPUT, batch_on_fail=False, "
+    "on_type_error=fastnumbers.RAISE, allow_underscores=False, map=False)\n"
     "Quickly convert input to an *int*, truncating if a *float*.\n"
     "\n"
     "Any input that is valid for the built-in *int*\n"
@@ -370,7 +506,14 @@ PyDoc_STRVAR(
     "    as-is. Other valid values are *RAISE* to indicate a *ValueError* should\n"
     "    be raised, a callable accepting a single argument that will be called with\n"
     "    the input to return an alternate value, or a default value to be returned\n"
-    "    instead of the input.\n"
+    "    instead of the input. If *map* is *True* or *list*, *SKIP* may be given to\n"
+    "    leave the element out of the result entirely.\n"
+    "batch_on_fail : bool, optional\n"
+    "    If *True* and `on_fail` is a callable, the callable is given a *list* of\n"
+    "    failing inputs and must return a sequence with one replacement per input.\n"
+    "    If *map* is *list*, failures are collected and given to the callable in\n"
+    "    chunks, so it is called far less often than once per failure. The default\n"
+    "    is *False*.\n"
     "on_type_error : optional\n"
     "    Control what happens when the input is neither numeric nor string. Behavior\n"
     "    matches that of `on_fail` except that the default value is *RAISE* and a\n"
@@ -735,6 +878,215 @@ PyDoc_STRVAR(
     "\n"
 );
 
+PyDoc_STRVAR(
+    all_int__doc__,
+    "all_int(input, *, consider=None, base=0, allow_underscores=False)\n"
+    "Quickly determine if every element of an iterable is an `int`.\n"
+    "\n"
+    "This is equivalent to ``all(check_int(x) for x in input)``.\n"
+    "Iteration stops at the first element that fails the check, and runs of\n"
+    "ASCII strings in a *list* or *tuple* are checked without holding the GIL.\n"
+    "\n"
+    "Parameters\n"
+    "----------\n"
+    "input :\n"
+    "    The iterable of values to test.\n"
+    "consider : optional\n"
+    "    Control the data types that may be interpreted. By default both string and\n"
+    "    numeric input may be considered. If given *STRING_ONLY*, then only string\n"
+    "    input may pass the check. if given *NUMBER_ONLY*, then only numeric input\n"
+    "    may pass the check. Giving *None* is equivalent to omitting this argument.\n"
+    "base : int, optional\n"
+    "    Follows the rules of Python's built-in :func:`int`; see it's\n"
+    "    documentation for your Python version. Ignored unless the input is\n"
+    "    of type `str`.\n"
+    "allow_underscores : bool, optional\n"
+    "    Underscores are allowed in numeric literals and in strings passed to `int`\n"
+    "    or `float` (see PEP 515 for details on what is and is not allowed). You can\n"
+    "    enable that behavior by setting this option to *True* - the default is\n"
+    "    *False*.\n"
+    "\n"
+    "Returns\n"
+    "-------\n"
+    "result : bool\n"
+    "    Whether or not all elements are an `int`. *True* for empty input.\n"
+    "\n"
+    "See Also\n"
+    "--------\n"
+    "check_int\n"
+    "all_float\n"
+    "\n"
+    "Examples\n"
+    "--------\n"
+    "\n"
+    "    >>> from fastnumbers import all_int\n"
+    "    >>> all_int(['56', '-4', 7])\n"
+    "    True\n"
+    "    >>> all_int(['56', '56.0', 7])\n"
+    "    False\n"
+    "\n"
+);
+
+PyDoc_STRVAR(
+    all_float__doc__,
+    "all_float(input, *, inf=NUMBER_ONLY, nan=NUMBER_ONLY, consider=None, "
+    "strict=False, allow_underscores=False)\n"
+    "Quickly determine if every element of an iterable is a `float`.\n"
+    "\n"
+    "This is equivalent to ``all(check_float(x) for x in input)``.\n"
+    "Iteration stops at the first element that fails the check, and runs of\n"
+    "ASCII strings in a *list* or *tuple* are checked without holding the GIL.\n"
+    "\n"
+    "Parameters\n"
+    "----------\n"
+    "input :\n"
+    "    The iterable of values to test.\n"
+    "inf : optional\n"
+    "    Control if and in what form INF is interpreted. The default is\n"
+    "    *NUMBER_ONLY*, see :func:`check_real` for the possible values.\n"
+    "nan : optional\n"
+    "    Control if and in what form NaN is interpreted. The default is\n"
+    "    *NUMBER_ONLY*, see :func:`check_real` for the possible values.\n"
+    "consider : optional\n"
+    "    Control the data types that may be interpreted. By default both string and\n"
+    "    numeric input may be considered. If given *STRING_ONLY*, then only string\n"
+    "    input may pass the check. if given *NUMBER_ONLY*, then only numeric input\n"
+    "    may pass the check. Giving *None* is equivalent to omitting this argument.\n"
+    "strict : bool, optional\n"
+    "    Control whether a string containing an integer is considered a `float`.\n"
+    "    The default is *False*, see :func:`check_float`.\n"
+    "allow_underscores : bool, optional\n"
+    "    Underscores are allowed in numeric literals and in strings passed to `int`\n"
+    "    or `float` (see PEP 515 for details on what is and is not allowed). You can\n"
+    "    enable that behavior by setting this option to *True* - the default is\n"
+    "    *False*.\n"
+    "\n"
+    "Returns\n"
+    "-------\n"
+    "result : bool\n"
+    "    Whether or not all elements are a `float`. *True* for empty input.\n"
+    "\n"
+    "See Also\n"
+    "--------\n"
+    "check_float\n"
+    "all_int\n"
+    "\n"
+    "Examples\n"
+    "--------\n"
+    "\n"
+    "    >>> from fastnumbers import all_float\n"
+    "    >>> all_float(['56.07', '56', 1e5])\n"
+    "    True\n"
+    "    >>> all_float(['56.07', '56'], strict=True)\n"
+    "    False\n"
+    "\n"
+);
+
+PyDoc_STRVAR(
+    any_invalid__doc__,
+    "any_invalid(input, *, inf=NUMBER_ONLY, nan=NUMBER_ONLY, consider=None, "
+    "allow_underscores=False)\n"
+    "Quickly determine if any element of an iterable is not a real number.\n"
+    "\n"
+    "This is equivalent to ``not all(check_real(x) for x in input)``.\n"
+    "Iteration stops at the first element that fails the check, and runs of\n"
+    "ASCII strings in a *list* or *tuple* are checked without holding the GIL.\n"
+    "\n"
+    "Parameters\n"
+    "----------\n"
+    "input :\n"
+    "    The iterable of values to test.\n"
+    "inf : optional\n"
+    "    Control if and in what form INF is interpreted. The default is\n"
+    "    *NUMBER_ONLY*, see :func:`check_real` for the possible values.\n"
+    "nan : optional\n"
+    "    Control if and in what form NaN is interpreted. The default is\n"
+    "    *NUMBER_ONLY*, see :func:`check_real` for the possible values.\n"
+    "consider : optional\n"
+    "    Control the data types that may be interpreted. By default both string and\n"
+    "    numeric input may be considered. If given *STRING_ONLY*, then only string\n"
+    "    input may pass the check. if given *NUMBER_ONLY*, then only numeric input\n"
+    "    may pass the check. Giving *None* is equivalent to omitting this argument.\n"
+    "allow_underscores : bool, optional\n"
+    "    Underscores are allowed in numeric literals and in strings passed to `int`\n"
+    "    or `float` (see PEP 515 for details on what is and is not allowed). You can\n"
+    "    enable that behavior by setting this option to *True* - the default is\n"
+    "    *False*.\n"
+    "\n"
+    "Returns\n"
+    "-------\n"
+    "result : bool\n"
+    "    Whether or not any element is not a real number. *False* for empty input.\n"
+    "\n"
+    "See Also\n"
+    "--------\n"
+    "check_real\n"
+    "first_invalid_index\n"
+    "\n"
+    "Examples\n"
+    "--------\n"
+    "\n"
+    "    >>> from fastnumbers import any_invalid\n"
+    "    >>> any_invalid(['56', '56.07', 4])\n"
+    "    False\n"
+    "    >>> any_invalid(['56', '56.07 lb', 4])\n"
+    "    True\n"
+    "\n"
+);
+
+PyDoc_STRVAR(
+    first_invalid_index__doc__,
+    "first_invalid_index(input, *, inf=NUMBER_ONLY, nan=NUMBER_ONLY, consider=None, "
+    "allow_underscores=False)\n"
+    "Quickly find the index of the first element of an iterable that is not a real "
+    "number.\n"
+    "\n"
+    "Iteration stops at the first element that fails the check, and runs of\n"
+    "ASCII strings in a *list* or *tuple* are checked without holding the GIL.\n"
+    "\n"
+    "Parameters\n"
+    "----------\n"
+    "input :\n"
+    "    The iterable of values to test.\n"
+    "inf : optional\n"
+    "    Control if and in what form INF is interpreted. The default is\n"
+    "    *NUMBER_ONLY*, see :func:`check_real` for the possible values.\n"
+    "nan : optional\n"
+    "    Control if and in what form NaN is interpreted. The default is\n"
+    "    *NUMBER_ONLY*, see :func:`check_real` for the possible values.\n"
+    "consider : optional\n"
+    "    Control the data types that may be interpreted. By default both string and\n"
+    "    numeric input may be considered. If given *STRING_ONLY*, then only string\n"
+    "    input may pass the check. if given *NUMBER_ONLY*, then only numeric input\n"
+    "    may pass the check. Giving *None* is equivalent to omitting this argument.\n"
+    "allow_underscores : bool, optional\n"
+    "    Underscores are allowed in numeric literals and in strings passed to `int`\n"
+    "    or `float` (see PEP 515 for details on what is and is not allowed). You can\n"
+    "    enable that behavior by setting this option to *True* - the default is\n"
+    "    *False*.\n"
+    "\n"
+    "Returns\n"
+    "-------\n"
+    "result : int\n"
+    "    The index of the first element that is not a real number, or -1 if\n"
+    "    all elements are real numbers.\n"
+    "\n"
+    "See Also\n"
+    "--------\n"
+    "check_real\n"
+    "any_invalid\n"
+    "\n"
+    "Examples\n"
+    "--------\n"
+    "\n"
+    "    >>> from fastnumbers import first_invalid_index\n"
+    "    >>> first_invalid_index(['56', '56.07 lb', 4, 'x'])\n"
+    "    1\n"
+    "    >>> first_invalid_index(['56', '56.07', 4])\n"
+    "    -1\n"
+    "\n"
+);
+
 PyDoc_STRVAR(
     query_type__doc__,
     "query_type(x, *, allow_inf=False, allow_nan=False, coerce=False, allowed_types=*, "
@@ -811,6 +1163,67 @@ PyDoc_STRVAR(
     "\n"
 );
 
+PyDoc_STRVAR(
+    query_type_codes__doc__,
+    "query_type_codes(input, output=None, *, allow_underscores=False)\n"
+    "Quickly classify each element of an iterable with a compact type code.\n"
+    "\n"
+    "This is a batch analogue of :func:`query_type` intended for schema inference\n"
+    "over large columns of data. Rather than returning a type object per element,\n"
+    "a single byte code is stored for each element, and a count of how many\n"
+    "elements received each code is returned alongside the codes.\n"
+    "\n"
+    "The codes are the members of :class:`TypeCode`:\n"
+    "\n"
+    "    - ``INT`` (0): an *int*, or a string containing an integer\n"
+    "    - ``FLOAT`` (1): a finite *float* that is not int-like\n"
+    "    - ``INTLIKE`` (2): a finite *float* with no fractional component\n"
+    "    - ``NAN`` (3): NaN, or a string containing NaN\n"
+    "    - ``INF`` (4): infinity, or a string containing infinity\n"
+    "    - ``INVALID`` (5): a string that does not contain a number\n"
+    "    - ``OTHER`` (6): input that is neither a string nor a number\n"
+    "\n"
+    "The input may be whitespace-padded.\n"
+    "\n"
+    "Parameters\n"
+    "----------\n"
+    "input :\n"
+    "    The iterable of values to classify.\n"
+    "output : optional\n"
+    "    If specified, it is an already existing one-dimensional array object of\n"
+    "    unsigned 8-bit integers that will contain the codes. It must be of the\n"
+    "    same length as the input. If *None*, a *bytearray* will be created.\n"
+    "allow_underscores : bool, optional\n"
+    "    Underscores are allowed in numeric literals and in strings passed to *int*\n"
+    "    or *float* (see PEP 515 for details on what is and is not allowed). You can\n"
+    "    enable that behavior by setting this option to *True* - the default is\n"
+    "    *False*.\n"
+    "\n"
+    "Returns\n"
+    "-------\n"
+    "codes :\n"
+    "    The array containing the code for each element.\n"
+    "counts : tuple of int\n"
+    "    The number of elements having each code, indexed by code.\n"
+    "\n"
+    "See Also\n"
+    "--------\n"
+    "query_type\n"
+    "\n"
+    "Examples\n"
+    "--------\n"
+    "\n"
+    "    >>> from fastnumbers import query_type_codes, TypeCode\n"
+    "    >>> codes, counts = query_type_codes(['56', '56.07', '56.0', 'nan', None])\n"
+    "    >>> list(codes)\n"
+    "    [0, 1, 2, 3, 6]\n"
+    "    >>> counts\n"
+    "    (1, 1, 1, 1, 0, 0, 1)\n"
+    "    >>> counts[TypeCode.INVALID]\n"
+    "    0\n"
+    "\n"
+);
+
 PyDoc_STRVAR(
     fastnumbers_int__doc__,
     "int(x=0, *, base=10)\n"
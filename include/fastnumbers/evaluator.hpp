@@ -57,6 +57,11 @@ public:
      */
     Payload as_type(const UserType ntype) noexcept
     {
+        // Scaled integers use the same logic for every parser
+        if (ntype == UserType::SCALED_INT) {
+            return as_scaled_int();
+        }
+
         // Send to the appropriate convenience function based on the found type
         switch (parser_type()) {
         case ParserType::UNICODE:
@@ -198,6 +203,31 @@ private:
         return convert(m_parser.as_pyint(), UserType::INT);
     }
 
+    /// Logic for evaluating any python object as a scaled integer
+    Payload as_scaled_int() noexcept
+    {
+        if (parser_type() == ParserType::UNICODE && !options().allow_unicode()) {
+            return ActionType::ERROR_INVALID_SCALED_INT;
+        }
+        return std::visit(
+            overloaded {
+                [](const long long value) -> Payload {
+                    return PyLong_FromLongLong(value);
+                },
+                [](const ErrorType err) -> Payload {
+                    if (err == ErrorType::BAD_VALUE) {
+                        return ActionType::ERROR_INVALID_SCALED_INT;
+                    } else if (err == ErrorType::OVERFLOW_) {
+                        return ActionType::ERROR_SCALED_INT_OVERFLOW;
+                    } else {
+                        return ActionType::ERROR_BAD_TYPE_INT;
+                    }
+                },
+            },
+            m_parser.template as_scaled_number<long long>()
+        );
+    }
+
     /// Return an error due to a bad type
     static Payload typed_error(const UserType ntype, const bool type = true) noexcept
     {
@@ -22,3 +22,104 @@ using AnyParser = std::variant<CharacterParser, UnicodeParser, NumericParser>;
 AnyParser extract_parser(
     PyObject* obj, Buffer& buffer, const UserOptions& options
 ) noexcept(false);
+
+/**
+ * \class ParserDispatch
+ * \brief Give each of a series of Python objects to a function along with
+ *        the appropriate parser for its data
+ *
+ * Which parser to use is decided from the type of the object, and that
+ * decision is only made again when the type differs from that of the
+ * previous object. Within a run of numbers, ASCII str, or bytes, the parser
+ * is constructed directly and the function is called without going through
+ * the AnyParser variant. Anything else is handled by extract_parser().
+ */
+class ParserDispatch {
+public:
+    /// Construct without having seen any type
+    ParserDispatch() noexcept
+        : m_type(nullptr)
+        , m_kind(Kind::OTHER)
+        , m_buffer()
+    { }
+
+    // Copy and assignment are disallowed
+    ParserDispatch(const ParserDispatch&) = delete;
+    ParserDispatch(ParserDispatch&&) = delete;
+    ParserDispatch& operator=(const ParserDispatch&) = delete;
+    ~ParserDispatch() = default;
+
+    /**
+     * \brief Call a function with the appropriate parser for an object
+     * \param obj The Python object from which to extract data
+     * \param options A UserOptions instance containing the options
+     *                specified by the user.
+     * \param function A function accepting any of the parsers
+     * \return The return value of the function
+     */
+    template <typename Function>
+    auto operator()(PyObject* obj, const UserOptions& options, Function function)
+        noexcept(false)
+    {
+        PyTypeObject* type = Py_TYPE(obj);
+        if (type != m_type) {
+            m_type = type;
+            m_kind = kind_of(type);
+        }
+
+        switch (m_kind) {
+        case Kind::NUMERIC:
+            return function(NumericParser(obj, options));
+        case Kind::STR:
+            if (PyUnicode_IS_READY(obj) && PyUnicode_IS_COMPACT_ASCII(obj)) {
+                return function(CharacterParser(
+                    (const char*)PyUnicode_1BYTE_DATA(obj),
+                    static_cast<const std::size_t>(PyUnicode_GET_LENGTH(obj)),
+                    options
+                ));
+            }
+            break;
+        case Kind::BYTES:
+            return function(CharacterParser(
+                PyBytes_AS_STRING(obj),
+                static_cast<const std::size_t>(PyBytes_GET_SIZE(obj)),
+                options
+            ));
+        default:
+            break;
+        }
+        return std::visit(function, extract_parser(obj, m_buffer, options));
+    }
+
+private:
+    /// How objects of a type are parsed, in the order extract_parser() checks
+    enum class Kind {
+        NUMERIC,
+        STR,
+        BYTES,
+        OTHER,
+    };
+
+    /// The type of the previous object
+    PyTypeObject* m_type;
+
+    /// How objects of the type of the previous object are parsed
+    Kind m_kind;
+
+    /// Storage for extract_parser()
+    Buffer m_buffer;
+
+    /// Decide how objects of a type are parsed
+    static Kind kind_of(PyTypeObject* type) noexcept
+    {
+        const PyNumberMethods* nmeth = type->tp_as_number;
+        if (nmeth && (nmeth->nb_index || nmeth->nb_int || nmeth->nb_float)) {
+            return Kind::NUMERIC;
+        } else if (PyType_FastSubclass(type, Py_TPFLAGS_UNICODE_SUBCLASS)) {
+            return Kind::STR;
+        } else if (PyType_FastSubclass(type, Py_TPFLAGS_BYTES_SUBCLASS)) {
+            return Kind::BYTES;
+        }
+        return Kind::OTHER;
+    }
+};
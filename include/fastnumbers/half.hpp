@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+/**
+ * \class Half
+ * \brief An IEEE 754 binary16 ("half precision") floating point value
+ *
+ * C++17 has no portable 16-bit floating point type, so this stores the bits
+ * directly. It only supports what is needed to populate an output buffer
+ * of format 'e' - creation from a double and classification.
+ */
+class Half {
+public:
+    /// Default construct as positive zero
+    Half() noexcept
+        : m_bits(0)
+    { }
+
+    /**
+     * \brief Construct from a double, rounding to nearest (ties to even)
+     *
+     * Values too large for a half become infinity, values too small become
+     * zero (or a subnormal), exactly like casting a double to a float.
+     * The rounding is done directly from the double, to avoid the double
+     * rounding that would come from using a float as an intermediate.
+     */
+    explicit Half(const double value) noexcept
+        : m_bits(from_double(value, 0))
+    { }
+
+    /**
+     * \brief Construct from a double that was itself rounded from a more
+     *        precise value, rounding as that value would have been
+     *
+     * Only a double exactly halfway between two halves can be rounded
+     * differently than the more precise value (see is_halfway()), so this
+     * is the same as Half(value) except for those.
+     *
+     * \param value The rounded double
+     * \param excess -1, 0, or 1 if the magnitude of the more precise value
+     *               is less than, equal to, or greater than that of the double
+     */
+    Half(const double value, const int excess) noexcept
+        : m_bits(from_double(value, excess))
+    { }
+
+    /// Whether or not a double lies exactly halfway between two halves
+    static bool is_halfway(const double value) noexcept
+    {
+        return from_double(value, -1) != from_double(value, 1);
+    }
+
+    /// Whether or not the value is NaN
+    bool is_nan() const noexcept
+    {
+        return (m_bits & EXPONENT_MASK) == EXPONENT_MASK && (m_bits & MANTISSA_MASK);
+    }
+
+    /// Whether or not the value is infinity
+    bool is_inf() const noexcept
+    {
+        return (m_bits & (EXPONENT_MASK | MANTISSA_MASK)) == EXPONENT_MASK;
+    }
+
+    /// Compare the bits of two values
+    bool operator==(const Half& other) const noexcept { return m_bits == other.m_bits; }
+
+private:
+    static constexpr uint16_t SIGN_MASK = 0x8000;
+    static constexpr uint16_t EXPONENT_MASK = 0x7C00;
+    static constexpr uint16_t MANTISSA_MASK = 0x03FF;
+
+    /// The bits of the half value
+    uint16_t m_bits;
+
+    /// Round away the lowest \a shift bits of \a mantissa, ties to even
+    /// unless the \a excess of the value being rounded breaks the tie
+    static uint64_t
+    round_shift(const uint64_t mantissa, const int shift, const int excess) noexcept
+    {
+        const uint64_t result = mantissa >> shift;
+        const uint64_t remainder = mantissa & ((uint64_t(1) << shift) - 1);
+        const uint64_t halfway = uint64_t(1) << (shift - 1);
+        const bool up_on_tie = excess == 0 ? (result & 1) != 0 : excess > 0;
+        if (remainder > halfway || (remainder == halfway && up_on_tie)) {
+            return result + 1;
+        }
+        return result;
+    }
+
+    /// Convert the bits of a double into the bits of a half
+    static uint16_t from_double(const double value, const int excess) noexcept
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        const uint16_t sign = static_cast<uint16_t>((bits >> 48) & SIGN_MASK);
+        const int exponent = static_cast<int>((bits >> 52) & 0x7FF);
+        const uint64_t mantissa = bits & 0xFFFFFFFFFFFFFULL;
+
+        // Infinity and NaN (keep NaN quiet, and keep as much payload as fits)
+        if (exponent == 0x7FF) {
+            if (mantissa == 0) {
+                return sign | EXPONENT_MASK;
+            }
+            return sign | EXPONENT_MASK | 0x0200 | static_cast<uint16_t>(mantissa >> 42);
+        }
+
+        // Re-bias the exponent. Too large becomes infinity.
+        const int half_exponent = exponent - 1023 + 15;
+        if (half_exponent >= 0x1F) {
+            return sign | EXPONENT_MASK;
+        }
+
+        // Normal values drop 42 bits of mantissa. A carry out of the mantissa
+        // correctly bumps the exponent (and may round up to infinity).
+        if (half_exponent > 0) {
+            const uint64_t rounded = round_shift(mantissa, 42, excess);
+            return sign
+                | static_cast<uint16_t>((uint64_t(half_exponent) << 10) + rounded);
+        }
+
+        // Subnormal values (and zero) must include the implicit bit,
+        // and drop more bits the smaller the exponent is.
+        const int shift = 42 + 1 - half_exponent;
+        if (shift > 63) {
+            return sign;
+        }
+        const uint64_t full_mantissa = mantissa | (uint64_t(1) << 52);
+        return sign | static_cast<uint16_t>(round_shift(full_mantissa, shift, excess));
+    }
+};
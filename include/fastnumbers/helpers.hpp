@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 /// Always evaluates to false - helps with static_assert messages
 template <class>
 inline constexpr bool always_false_v = false;
@@ -71,3 +73,67 @@ inline PyObject* pyobject_from_int(const T value) noexcept
         return PyLong_FromUnsignedLong(static_cast<unsigned long>(value));
     };
 }
+
+/// The number of conversion failures collected before a batched callable is called
+inline constexpr std::size_t FAIL_BATCH_SIZE = 1024;
+
+/**
+ * \brief Call a batched callable, which accepts a list of inputs and returns
+ *        a sequence with one replacement per input
+ * \param callable The Python callable object
+ * \param inputs The Python list of inputs given to the callable
+ * \return New reference to a list or tuple of the replacements,
+ *         or nullptr with a Python exception set
+ */
+inline PyObject* call_batched_callable(PyObject* callable, PyObject* inputs) noexcept
+{
+    PyObject* retval = PyObject_CallFunctionObjArgs(callable, inputs, nullptr);
+    if (retval == nullptr) {
+        return nullptr;
+    }
+    PyObject* replacements = PySequence_Fast(
+        retval, "Callable passed to 'on_fail' must return a sequence"
+    );
+    Py_DECREF(retval);
+    if (replacements == nullptr) {
+        return nullptr;
+    }
+    const Py_ssize_t expected = PyList_GET_SIZE(inputs);
+    const Py_ssize_t given = PySequence_Fast_GET_SIZE(replacements);
+    if (given != expected) {
+        PyErr_Format(
+            PyExc_ValueError,
+            "Callable passed to 'on_fail' returned %zd replacements for %zd inputs",
+            given,
+            expected
+        );
+        Py_DECREF(replacements);
+        return nullptr;
+    }
+    return replacements;
+}
+
+/**
+ * \brief Call a batched callable for only one input
+ * \param callable The Python callable object
+ * \param input The Python object given to the callable (inside a list)
+ * \return New reference to the replacement, or nullptr with a Python exception set
+ */
+inline PyObject* call_batched_callable_once(PyObject* callable, PyObject* input) noexcept
+{
+    PyObject* inputs = PyList_New(1);
+    if (inputs == nullptr) {
+        return nullptr;
+    }
+    Py_INCREF(input);
+    PyList_SET_ITEM(inputs, 0, input);
+    PyObject* replacements = call_batched_callable(callable, inputs);
+    Py_DECREF(inputs);
+    if (replacements == nullptr) {
+        return nullptr;
+    }
+    PyObject* replacement = PySequence_Fast_GET_ITEM(replacements, 0);
+    Py_INCREF(replacement);
+    Py_DECREF(replacements);
+    return replacement;
+}
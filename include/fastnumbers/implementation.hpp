@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <utility>
@@ -7,10 +9,31 @@
 #include <Python.h>
 
 #include "fastnumbers/evaluator.hpp"
+#include "fastnumbers/exception.hpp"
+#include "fastnumbers/extractor.hpp"
 #include "fastnumbers/resolver.hpp"
 #include "fastnumbers/selectors.hpp"
 #include "fastnumbers/user_options.hpp"
 
+/**
+ * \brief Compact per-element classification used for batch type queries
+ *
+ * The numeric values are part of the public API (they are mirrored by
+ * fastnumbers.TypeCode in Python) so they must not be re-ordered.
+ */
+enum class TypeCode : uint8_t {
+    INT = 0, ///< An integer, or a string containing an integer
+    FLOAT = 1, ///< A finite float that is not int-like
+    INTLIKE = 2, ///< A finite float with no fractional component
+    NAN_ = 3, ///< A float that is NaN, or a string containing NaN
+    INF = 4, ///< A float that is infinite, or a string containing infinity
+    INVALID = 5, ///< Textual input that does not contain a number
+    OTHER = 6, ///< Input that is neither textual nor numeric
+};
+
+/// The number of distinct values in TypeCode
+constexpr std::size_t N_TYPE_CODES = 7;
+
 /**
  * \class Implementation
  * \brief Encapsulates the logic of driving conversion/checking
@@ -71,12 +94,40 @@ public:
     /// Convert the object to the desired user type
     PyObject* convert(PyObject* input) const noexcept(false);
 
+    /// Convert one of a series of objects to the desired user type, using
+    /// a dispatch that is shared by the whole series
+    PyObject* convert(PyObject* input, ParserDispatch& dispatch) const noexcept(false);
+
     /// Check if the object is the desired user type
     PyObject* check(PyObject* input) const noexcept(false);
 
+    /// Check if the object is the desired user type, as a C++ bool
+    bool is_type(PyObject* input) const noexcept(false);
+
+    /**
+     * \brief Check if ASCII character data is the desired user type
+     *
+     * This does not touch any Python objects, so it may be called
+     * without holding the GIL.
+     *
+     * \param str The ASCII character data, which need not be nul-terminated
+     * \param len The length of the character data
+     */
+    bool is_type(const char* str, const std::size_t len) const noexcept;
+
     /// Query the type of the object
     PyObject* query_type(PyObject* input) const noexcept(false);
 
+    /// Query the type of the object as a compact code
+    TypeCode query_type_code(PyObject* input) const noexcept(false);
+
+    /**
+     * \brief Query the type of ASCII character data as a compact code
+     *
+     * Like is_type for character data, this may be called without the GIL.
+     */
+    TypeCode query_type_code(const char* str, const std::size_t len) const noexcept;
+
     /// Set the action to perform when INF is found
     void set_inf_action(PyObject* val) noexcept(false)
     {
@@ -105,6 +156,58 @@ public:
         m_resolver.set_type_error_action(val);
     }
 
+    /// Set the action to perform on overflow
+    void set_overflow_action(PyObject* val) noexcept(false)
+    {
+        if (val == Selectors::CLAMP) {
+            throw fastnumbers_exception(
+                "fastnumbers.CLAMP is only supported for 'on_overflow' of try_array"
+            );
+        }
+        validate_not_allow_disallow_str_only_num_only(val);
+        m_resolver.set_overflow_action(val);
+    }
+
+    /// Set whether a callable given for conversion failure accepts a list of inputs
+    void set_fail_batched(const bool val) noexcept { m_resolver.set_fail_batched(val); }
+
+    /// The callable for conversion failure if it accepts a list of inputs,
+    /// otherwise nullptr
+    PyObject* batched_fail_callable() const noexcept
+    {
+        return m_resolver.batched_fail_callable();
+    }
+
+    /// Return a copy that gives Selectors::PENDING on conversion failure,
+    /// so that the failure can be resolved later as part of a batch
+    Implementation with_deferred_fail() const noexcept
+    {
+        Implementation deferred(*this);
+        deferred.m_resolver.set_fail_action(Selectors::PENDING);
+        return deferred;
+    }
+
+    /**
+     * \brief Validate that no action is SKIP, which only has meaning when
+     *        converting the elements of an iterable
+     * \throws fastnumbers_exception if any action is SKIP
+     */
+    void validate_not_skip() const noexcept(false)
+    {
+        if (m_resolver.skips()) {
+            throw fastnumbers_exception(
+                "fastnumbers.SKIP is only allowed when map is True or list"
+            );
+        }
+    }
+
+    /// Set the power of ten by which to scale integers
+    void set_scale(const int val) noexcept
+    {
+        m_options.set_scale(val);
+        m_resolver.set_scale(val);
+    }
+
     /// Set whether or not underscores are allowed in strings
     void set_underscores_allowed(const bool val) noexcept
     {
@@ -187,11 +290,15 @@ private:
     NumberFlags collect_type(PyObject* obj) const noexcept(false);
 
     /// Convert the object to the desired user type
-    Payload collect_payload(PyObject* obj) const noexcept(false);
+    Payload
+    collect_payload(PyObject* obj, ParserDispatch& dispatch) const noexcept(false);
 
     /// Figure out as what types we can label the input
     Types resolve_types(const NumberFlags& flags) const noexcept;
 
+    /// Decide if the number flags are of the desired user type
+    bool is_type_from_flags(const NumberFlags& flags) const noexcept;
+
     /// Create an options object with base - used in initialization list
     UserOptions create_options_with_base(const int base) const noexcept
     {
@@ -237,6 +344,18 @@ PyObject* list_iteration_impl(
     PyObject* input, std::function<PyObject*(PyObject*)> convert
 ) noexcept(false);
 
+/**
+ * \brief Iterate over the elements of a collection and convert each one into a list,
+ *        giving conversion failures to a batched callable a chunk at a time
+ *
+ * \param input The given input object that should be iterable
+ * \param impl The Implementation that performs the conversion, which must
+ *             have a batched callable for conversion failure
+ * \return A new python list containing the converted results, or nullptr on error
+ */
+PyObject*
+list_batched_iteration_impl(PyObject* input, const Implementation& impl) noexcept(false);
+
 /**
  * \brief Iterate over the elements of a collection and convert each one into an iterator
  *
@@ -248,6 +367,35 @@ PyObject* iter_iteration_impl(
     PyObject* input, std::function<PyObject*(PyObject*)> convert
 ) noexcept(false);
 
+/// The type of the iterator returned by iter_iteration_impl
+extern PyTypeObject FastnumbersIteratorType;
+
+/**
+ * \brief Find the first element of a collection that fails the type check
+ *
+ * Iteration stops at the first failing element. For lists and tuples,
+ * runs of ASCII str elements are checked without holding the GIL.
+ *
+ * \param input The given input object that should be iterable
+ * \param impl The Implementation that performs the type check
+ * \return The index of the first failing element, or -1 if all pass
+ */
+Py_ssize_t
+first_failing_index_impl(PyObject* input, const Implementation& impl) noexcept(false);
+
+/**
+ * \brief Iterate over the elements of a collection and classify each one
+ *
+ * \param input The given input object that should be iterable
+ * \param output The object containing the uint8 array to populate,
+ *               or nullptr to have a bytearray created
+ * \param allow_underscores Whether or not it is OK for numbers to contain underscores
+ * \return A new tuple of the populated output and a tuple of counts for each code
+ */
+PyObject* query_type_codes_impl(
+    PyObject* input, PyObject* output, bool allow_underscores
+) noexcept(false);
+
 /**
  * \brief Iterate over the elements of a collection and convert each one
  *
@@ -260,6 +408,13 @@ PyObject* iter_iteration_impl(
  * \param on_type_error The object specifying what action to take on type error
  * \param allow_underscores Whether or not it is OK for numbers to contain underscores
  * \param base The integer base use when parsing ints, use INT_MIN for default
+ * \param scale The power of ten by which to scale ints, use INT_MIN for none
+ * \param float_to_int How floats are converted when the output is integral
+ * \param batch_on_fail Whether or not a callable for on_fail accepts a list of inputs
+ * \param mask The object with one byte or bit per element to flag those that
+ *             failed, overflowed, had the wrong type, or were NaN (or nullptr)
+ * \param categories The categories indexed by the input if it holds the integer
+ *                   codes of dictionary-encoded data (or nullptr)
  */
 void array_impl(
     PyObject* input,
@@ -270,5 +425,64 @@ void array_impl(
     PyObject* on_overflow,
     PyObject* on_type_error,
     bool allow_underscores,
-    const int base = std::numeric_limits<int>::min()
+    const int base = std::numeric_limits<int>::min(),
+    const int scale = std::numeric_limits<int>::min(),
+    const FloatToInt float_to_int = FloatToInt::RAISE,
+    const bool batch_on_fail = false,
+    PyObject* mask = nullptr,
+    PyObject* categories = nullptr
+) noexcept(false);
+
+/**
+ * \brief Import the array.array type used by array_alloc_impl
+ *
+ * This is called once when the module is executed, so that no Python
+ * code has to run to find the type while converting.
+ *
+ * \return 0 on success, -1 on failure
+ */
+int import_array_type() noexcept;
+
+/**
+ * \brief Convert the elements of an iterable into a newly allocated array.array
+ *
+ * If the length of the input is known, the array is allocated up front.
+ * Otherwise the input is consumed once in chunks that double in size,
+ * and is never copied into a list.
+ *
+ * \param input The given input object that should be iterable
+ * \param typecode The array.array typecode (as a str) of the output, or nullptr
+ *                 or None for the default of "d"
+ * \param inf The object specifying what action to take if INF is found
+ * \param nan The object specifying what action to take if NaN is found
+ * \param on_fail The object specifying what action to take on conversion failure
+ * \param on_overflow The object specifying what action to take on overflow
+ * \param on_type_error The object specifying what action to take on type error
+ * \param allow_underscores Whether or not it is OK for numbers to contain underscores
+ * \param base The integer base use when parsing ints, use INT_MIN for default
+ * \param scale The power of ten by which to scale ints, use INT_MIN for none
+ * \param float_to_int How floats are converted when the output is integral
+ * \param batch_on_fail Whether or not a callable for on_fail accepts a list of inputs
+ * \param mask The object with one byte or bit per element to flag those that
+ *             failed, overflowed, had the wrong type, or were NaN (or nullptr).
+ *             When streaming, the flags are kept until the length is known.
+ * \param categories The categories indexed by the input if it holds the integer
+ *                   codes of dictionary-encoded data (or nullptr)
+ * \return A new array.array containing the converted values
+ */
+PyObject* array_alloc_impl(
+    PyObject* input,
+    PyObject* typecode,
+    PyObject* inf,
+    PyObject* nan,
+    PyObject* on_fail,
+    PyObject* on_overflow,
+    PyObject* on_type_error,
+    bool allow_underscores,
+    int base,
+    int scale,
+    FloatToInt float_to_int,
+    bool batch_on_fail,
+    PyObject* mask = nullptr,
+    PyObject* categories = nullptr
 ) noexcept(false);
\ No newline at end of file
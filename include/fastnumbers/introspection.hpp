@@ -1,5 +1,7 @@
 #pragma once
 
+#include "fastnumbers/half.hpp"
+
 /// Return a string form of the given type
 template <typename T>
 constexpr inline const char* type_name() noexcept;
@@ -75,3 +77,15 @@ constexpr inline const char* type_name<unsigned char>() noexcept
 {
     return "unsigned char";
 }
+
+template <>
+constexpr inline const char* type_name<bool>() noexcept
+{
+    return "bool";
+}
+
+template <>
+constexpr inline const char* type_name<Half>() noexcept
+{
+    return "half";
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstring>
 #include <functional>
 #include <optional>
 
@@ -8,6 +9,37 @@
 #include "fastnumbers/exception.hpp"
 #include "fastnumbers/selectors.hpp"
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+// How many elements ahead of the one being converted are prefetched when
+// walking a list, tuple, or array of objects. Define FN_PREFETCH_DISTANCE in
+// the environment when building to tune it (0 disables prefetching).
+#ifndef FN_PREFETCH_DISTANCE
+#define FN_PREFETCH_DISTANCE 8
+#endif
+
+/**
+ * \brief Hint that a Python object will soon be read
+ *
+ * The first two cache lines are fetched, which covers the header of any
+ * object as well as the text of a short compact str stored right after it.
+ */
+inline void prefetch_object(const PyObject* obj) noexcept
+{
+    const char* address = reinterpret_cast<const char*>(obj);
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, 3);
+    __builtin_prefetch(address + 64, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(address, _MM_HINT_T0);
+    _mm_prefetch(address + 64, _MM_HINT_T0);
+#else
+    (void)address;
+#endif
+}
+
 /// Obtain the length hint from a Python object
 inline Py_ssize_t get_length_hint(PyObject* length_hint_base) noexcept(false)
 {
@@ -56,6 +88,9 @@ public:
 
     /**
      * \brief Add an item to the end of the list
+     *
+     * If the item is the SKIP selector it is not added.
+     *
      * \param item The item to add to the list
      */
     void append(PyObject* item) noexcept(false)
@@ -65,6 +100,12 @@ public:
             throw exception_is_set();
         }
 
+        // Drop the reference the conversion gave us and leave a gap.
+        if (item == Selectors::SKIP) {
+            Py_DECREF(item);
+            return;
+        }
+
         // The list may have been pre-allocated using the length hint.
         // If so, the elements will be just populated with NULL.
         // If the current index equals the list size, that means we are
@@ -83,8 +124,56 @@ public:
         m_index += 1;
     }
 
+    /**
+     * \brief Replace an item that was already added to the list
+     * \param index The location of the item in the list
+     * \param item The new item, whose reference is stolen
+     */
+    void replace(const Py_ssize_t index, PyObject* item) noexcept
+    {
+        PyList_SetItem(m_list, index, item); // releases the old item
+    }
+
+    /**
+     * \brief Remove the SKIP selectors that replaced items already added
+     *
+     * The items after them are moved back to close the gaps.
+     *
+     * \param start The index from which to look for SKIP selectors
+     */
+    void remove_skipped(const Py_ssize_t start) noexcept
+    {
+        Py_ssize_t kept = start;
+        for (Py_ssize_t i = start; i < m_index; ++i) {
+            PyObject* item = PyList_GET_ITEM(m_list, i);
+            PyList_SET_ITEM(m_list, i, nullptr);
+            if (item == Selectors::SKIP) {
+                Py_DECREF(item);
+            } else {
+                PyList_SET_ITEM(m_list, kept, item);
+                kept += 1;
+            }
+        }
+        m_index = kept;
+    }
+
+    /// The number of items added to the list so far
+    Py_ssize_t size() const noexcept { return m_index; }
+
     /// Return the stored list to the user
-    PyObject* get() noexcept { return m_list; }
+    PyObject* get() noexcept(false)
+    {
+        // If fewer items were added than the length hint promised (e.g. some
+        // were skipped) the unused space at the end must be removed.
+        const Py_ssize_t allocated = PyList_GET_SIZE(m_list);
+        if (m_index < allocated) {
+            if (PyList_SetSlice(m_list, m_index, allocated, nullptr) != 0) {
+                Py_DECREF(m_list);
+                throw exception_is_set();
+            }
+        }
+        return m_list;
+    }
 
 private:
     /// The list itself
@@ -106,20 +195,35 @@ public:
      * \param length The initial length required of the array
      */
     explicit ArrayPopulator(Py_buffer& buffer, const Py_ssize_t length) noexcept(false)
-        : m_buf(buffer)
-        , m_index(0)
-        , m_stride(m_buf.strides != nullptr ? (m_buf.strides[0] / m_buf.itemsize) : 1)
+        : ArrayPopulator(
+              static_cast<char*>(buffer.buf),
+              buffer.strides != nullptr ? buffer.strides[0] : buffer.itemsize
+          )
     {
-        if (m_buf.ndim != 1) {
+        if (buffer.ndim != 1) {
             PyErr_SetString(PyExc_ValueError, "Can only accept arrays of dimension 1");
             throw exception_is_set();
         }
-        if (m_buf.shape[0] != length) {
+        if (buffer.shape[0] != length) {
             PyErr_SetString(PyExc_ValueError, "input/output must be of equal size");
             throw exception_is_set();
         }
     }
 
+    /**
+     * \brief Construct the manager for one strided run of memory
+     *
+     * No size checking is done, this is the responsibility of the caller.
+     *
+     * \param data Pointer to the location of the first element
+     * \param stride The number of bytes between consecutive elements
+     */
+    explicit ArrayPopulator(char* data, const Py_ssize_t stride) noexcept
+        : m_data(data)
+        , m_index(0)
+        , m_stride(stride)
+    { }
+
     // Deleted
     ArrayPopulator(const ArrayPopulator&) = delete;
     ArrayPopulator(ArrayPopulator&&) = delete;
@@ -130,24 +234,96 @@ public:
 
     /// \brief Place a return value in the next proper location of the buffer
     /// \param value The value to place
+    /// \return The location in which the value was placed
     template <typename T>
-    void place_next(const T value) noexcept
+    T* place_next(const T value) noexcept
     {
-        *(static_cast<T*>(m_buf.buf) + (m_index * m_stride)) = value;
+        T* location = reinterpret_cast<T*>(m_data + (m_index * m_stride));
+        *location = value;
         m_index += 1;
+        return location;
     }
 
 private:
-    /// The buffer where the data should be added
-    Py_buffer& m_buf;
+    /// The location of the first element
+    char* m_data;
 
     /// The current location where we should add to the array
     Py_ssize_t m_index;
 
-    /// Offset to use when determining the index
+    /// Offset in bytes between consecutive elements
     Py_ssize_t m_stride;
 };
 
+/**
+ * \class MaskPopulator
+ * \brief Handles the details of populating a mask buffer with one flag per element
+ *
+ * The mask may either have one byte per element, or be a bitmap with one
+ * bit per element (least-significant bit first). Which one is inferred
+ * from the size of the buffer.
+ */
+class MaskPopulator {
+public:
+    /**
+     * \brief Construct the manager with the buffer to manage
+     * \param buffer The Python memory buffer to populate, or nullptr for no mask
+     * \param length The number of elements that the mask must describe
+     */
+    explicit MaskPopulator(Py_buffer* buffer, const Py_ssize_t length) noexcept(false)
+        : m_data(buffer == nullptr ? nullptr : static_cast<unsigned char*>(buffer->buf))
+        , m_index(0)
+        , m_packed(false)
+    {
+        if (buffer == nullptr || buffer->len == length) {
+            return;
+        }
+        if (buffer->len != (length + 7) / 8) {
+            PyErr_SetString(
+                PyExc_ValueError,
+                "mask must have either one byte or one bit per element of the output"
+            );
+            throw exception_is_set();
+        }
+        m_packed = true;
+    }
+
+    // Deleted
+    MaskPopulator(const MaskPopulator&) = delete;
+    MaskPopulator(MaskPopulator&&) = delete;
+    MaskPopulator& operator=(const MaskPopulator&) = delete;
+
+    /// Default
+    ~MaskPopulator() = default;
+
+    /// \brief Record the flag of the next element, if there is a mask
+    /// \param flagged Whether or not the element is to be flagged
+    void place_next(const bool flagged) noexcept
+    {
+        if (m_data == nullptr) {
+            return;
+        }
+        if (m_packed) {
+            const unsigned char bit = static_cast<unsigned char>(1U << (m_index % 8));
+            unsigned char& byte = m_data[m_index / 8];
+            byte = flagged ? (byte | bit) : (byte & ~bit);
+        } else {
+            m_data[m_index] = flagged;
+        }
+        m_index += 1;
+    }
+
+private:
+    /// The location of the first byte (nullptr if there is no mask)
+    unsigned char* m_data;
+
+    /// The index of the next element to record
+    Py_ssize_t m_index;
+
+    /// Whether the mask is a bitmap rather than one byte per element
+    bool m_packed;
+};
+
 /// Track the state of the iteration
 enum class IterState {
     CONTINUE, ///< Keep the iteration going
@@ -168,6 +344,7 @@ public:
         : m_object(potential_iterable)
         , m_iterator(nullptr)
         , m_fast_sequence(nullptr)
+        , m_objects()
         , m_index(0)
         , m_seq_size(0)
         , m_convert(convert)
@@ -175,6 +352,8 @@ public:
         if (PyList_Check(m_object) || PyTuple_Check(m_object)) {
             m_fast_sequence = m_object;
             m_seq_size = PySequence_Fast_GET_SIZE(m_fast_sequence);
+        } else if (acquire_objects()) {
+            m_seq_size = m_objects.shape[0];
         } else {
             if ((m_iterator = PyObject_GetIter(m_object)) == nullptr) {
                 throw exception_is_set();
@@ -186,6 +365,9 @@ public:
     ~IterableManager() noexcept
     {
         Py_XDECREF(m_iterator);
+        if (m_objects.obj != nullptr) {
+            PyBuffer_Release(&m_objects);
+        }
 
         // It's possible the fast sequence *is* the object... only decrement
         // the reference if this is not the case.
@@ -203,7 +385,7 @@ public:
     /// data into a list in order to find the size.
     Py_ssize_t get_size() noexcept(false)
     {
-        if (m_fast_sequence != nullptr) {
+        if (m_fast_sequence != nullptr || m_objects.obj != nullptr) {
             return m_seq_size;
         } else if (PySequence_Check(m_object)) {
             return PySequence_Size(m_object);
@@ -335,6 +517,10 @@ private:
     /// NULL if not a fast sequence (e.g. list/tuple), the fast sequence object otherwise
     PyObject* m_fast_sequence;
 
+    /// The buffer of object pointers if the input is e.g. a numpy array of
+    /// dtype=object (the obj member is NULL otherwise)
+    Py_buffer m_objects;
+
     /// The location we are in the sequence, if the input is a sequence
     Py_ssize_t m_index;
 
@@ -345,23 +531,109 @@ private:
     std::function<PayloadType(PyObject*)> m_convert;
 
 private:
+    /**
+     * \brief Acquire the buffer of a one-dimensional array of Python objects
+     *
+     * Walking the pointers directly avoids the new reference per element
+     * that e.g. the numpy iterator would create. Strided buffers are fine.
+     *
+     * \return true if the input exposes such a buffer, false otherwise
+     */
+    bool acquire_objects() noexcept
+    {
+        if (!PyObject_CheckBuffer(m_object)) {
+            return false;
+        }
+        constexpr auto flags = PyBUF_STRIDES | PyBUF_FORMAT;
+        if (PyObject_GetBuffer(m_object, &m_objects, flags) != 0) {
+            // Fall back on the iteration protocol to report any problems
+            PyErr_Clear();
+            return false;
+        }
+        const bool is_objects = m_objects.ndim == 1 && m_objects.format != nullptr
+            && std::strcmp(m_objects.format, "O") == 0
+            && m_objects.itemsize == static_cast<Py_ssize_t>(sizeof(PyObject*));
+        if (!is_objects) {
+            PyBuffer_Release(&m_objects); // Also resets obj to NULL
+        }
+        return is_objects;
+    }
+
+    /// The location of an element of the array of objects
+    const char* object_location(const Py_ssize_t index) const noexcept
+    {
+        return static_cast<const char*>(m_objects.buf) + (index * m_objects.strides[0]);
+    }
+
     std::optional<PayloadType> next() noexcept(false)
     {
         PyObject* item = nullptr;
 
+        // The pointers of an array of objects are also borrowed references
+        // that can be accessed directly, like those of a fast sequence.
+        if (m_objects.obj != nullptr) {
+            if (m_index == m_seq_size) {
+                return std::nullopt;
+            }
+            std::memcpy(&item, object_location(m_index), sizeof(PyObject*));
+
+            // As for a list, the index is checked before the element ahead is
+            // located, and an uninitialized (NULL) element is not prefetched
+            const Py_ssize_t ahead = m_index + FN_PREFETCH_DISTANCE;
+            if (FN_PREFETCH_DISTANCE > 0 && ahead < m_seq_size) {
+                PyObject* ahead_item = nullptr;
+                std::memcpy(&ahead_item, object_location(ahead), sizeof(PyObject*));
+                if (ahead_item != nullptr) {
+                    prefetch_object(ahead_item);
+                }
+            }
+            m_index += 1;
+
+            // An uninitialized element is NULL, which numpy treats as None
+            return m_convert(item == nullptr ? Py_None : item);
+        }
+
         // If no iterator is stored, then the object was a fast sequence and
         // we can access the data directly.
         if (m_iterator == nullptr) {
-            // When at the end of the sequence, return the sigil
-            if (m_index == m_seq_size) {
+            // When at the end of the sequence, return the sigil. The current
+            // size is also checked in case a callable shortened the sequence.
+            if (m_index == m_seq_size
+                || m_index >= PySequence_Fast_GET_SIZE(m_fast_sequence)) {
                 return std::nullopt;
             }
 
+#ifdef Py_GIL_DISABLED
+            // Without the GIL another thread may replace or remove an element
+            // of a list while it is converted, so a borrowed reference could
+            // be freed under us. Hold a strong reference instead.
+            if (PyList_Check(m_fast_sequence)) {
+                item = PyList_GetItemRef(m_fast_sequence, m_index);
+                if (item == nullptr) {
+                    // The list was shortened since its size was checked
+                    PyErr_Clear();
+                    return std::nullopt;
+                }
+                m_index += 1;
+                return convert_owned(item);
+            }
+#endif
+
             // Access the data in the input sequence directly.
             // The returned object is a borrowed reference, so we do not
             // need to manage the reference counts.
             item = PySequence_Fast_GET_ITEM(m_fast_sequence, m_index);
 
+            // Most of the time of converting a large sequence is spent waiting
+            // for each object to be loaded from memory, so start loading those
+            // a few elements ahead while this one is converted. The current
+            // size is used in case the sequence was shortened by a callable.
+            const Py_ssize_t ahead = m_index + FN_PREFETCH_DISTANCE;
+            if (FN_PREFETCH_DISTANCE > 0
+                && ahead < PySequence_Fast_GET_SIZE(m_fast_sequence)) {
+                prefetch_object(PySequence_Fast_GET_ITEM(m_fast_sequence, ahead));
+            }
+
             // Before moving on, increment our internal counter.
             m_index += 1;
 
@@ -382,9 +654,18 @@ private:
             return std::nullopt;
         }
 
-        // Convert the item and return the value. When complete we must decrease
-        // the item reference count (because it was not returned as a borrowed
-        // reference), so some error handling must be done to ensure it happens.
+        return convert_owned(item);
+    }
+
+    /**
+     * \brief Convert an item that was given as a new reference
+     *
+     * When complete we must decrease the item reference count (because it
+     * was not a borrowed reference), so some error handling must be done to
+     * ensure it happens.
+     */
+    PayloadType convert_owned(PyObject* item) noexcept(false)
+    {
         try {
             PayloadType retval = m_convert(item);
             Py_DECREF(item);
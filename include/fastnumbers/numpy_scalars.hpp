@@ -0,0 +1,217 @@
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include <Python.h>
+
+/// The value of a numpy scalar - a signed integer, an unsigned integer,
+/// or a float - or std::monostate if the object was not such a scalar
+using NumpyScalar = std::variant<std::monostate, long long, unsigned long long, double>;
+
+/**
+ * \class NumpyScalarTypes
+ * \brief The numpy scalar types whose value can be read directly
+ *
+ * The types are looked up the first time a numpy scalar is seen (numpy has
+ * been imported by then, or there would be no scalar), so numpy is neither
+ * needed to build fastnumbers nor imported by it. Only the integer types and
+ * float32 are read - float64 is already a subclass of float, and the others
+ * (e.g. float16 or bool) are left to the number protocol.
+ */
+class NumpyScalarTypes {
+public:
+    // Copy and assignment are disallowed
+    NumpyScalarTypes(const NumpyScalarTypes&) = delete;
+    NumpyScalarTypes(NumpyScalarTypes&&) = delete;
+    NumpyScalarTypes& operator=(const NumpyScalarTypes&) = delete;
+
+    /// Release the types
+    ~NumpyScalarTypes() noexcept
+    {
+        for (const Entry& entry : m_entries) {
+            Py_DECREF(reinterpret_cast<PyObject*>(entry.type));
+        }
+    }
+
+    /**
+     * \brief Read the value of a numpy scalar
+     * \param obj The Python object that might be a numpy scalar
+     * \return The value, or std::monostate if obj is not a numpy scalar
+     *         of one of the types that are read
+     */
+    static NumpyScalar read(PyObject* obj) noexcept
+    {
+        // Turn away anything else without having to look up the types
+        const PyTypeObject* type = Py_TYPE(obj);
+        if (std::strncmp(type->tp_name, "numpy.", 6) != 0) {
+            return std::monostate();
+        }
+        const NumpyScalarTypes* types = instance();
+        if (types != nullptr) {
+            for (const Entry& entry : types->m_entries) {
+                if (entry.type == type) {
+                    return entry.read(obj);
+                }
+            }
+        }
+        return std::monostate();
+    }
+
+private:
+    /// Read the value of a scalar of a known type
+    using Reader = NumpyScalar (*)(PyObject*);
+
+    /// A scalar type and how to read its value
+    struct Entry {
+        PyTypeObject* type;
+        Reader read;
+    };
+
+    /// The layout of a numpy scalar, which is part of numpy's stable ABI
+    template <typename C>
+    struct ScalarFields {
+        PyObject_HEAD
+        C obval;
+    };
+
+    /// The scalar types to look up, some of which may be aliases of others
+    static constexpr const char* NAMES[] = {
+        "byte", "ubyte", "short", "ushort", "intc", "uintc", "long", "ulong",
+        "int_", "uint", "intp", "uintp", "longlong", "ulonglong", "single",
+    };
+
+    /// The types that were found
+    std::vector<Entry> m_entries;
+
+    /// Only constructed by load()
+    NumpyScalarTypes() noexcept
+        : m_entries()
+    { }
+
+    /// Read the value of a scalar holding the C type C
+    template <typename C>
+    static NumpyScalar read_value(PyObject* obj) noexcept
+    {
+        const C value = reinterpret_cast<const ScalarFields<C>*>(obj)->obval;
+        if constexpr (std::is_floating_point_v<C>) {
+            return static_cast<double>(value);
+        } else if constexpr (std::is_signed_v<C>) {
+            return static_cast<long long>(value);
+        } else {
+            return static_cast<unsigned long long>(value);
+        }
+    }
+
+    /// The reader for a scalar type given its dtype character code
+    static Reader reader_for(const char code) noexcept
+    {
+        switch (code) {
+        case 'b':
+            return read_value<signed char>;
+        case 'B':
+            return read_value<unsigned char>;
+        case 'h':
+            return read_value<short>;
+        case 'H':
+            return read_value<unsigned short>;
+        case 'i':
+            return read_value<int>;
+        case 'I':
+            return read_value<unsigned int>;
+        case 'l':
+            return read_value<long>;
+        case 'L':
+            return read_value<unsigned long>;
+        case 'q':
+            return read_value<long long>;
+        case 'Q':
+            return read_value<unsigned long long>;
+        case 'f':
+            return read_value<float>;
+        default:
+            return nullptr;
+        }
+    }
+
+    /**
+     * \brief The types, looked up once and then shared by all threads
+     *
+     * The first threads to get here may each look the types up, but only
+     * one table is published and the others are discarded. The published
+     * table is intentionally never destroyed so that no Python references
+     * are released after the interpreter is finalized.
+     *
+     * \return The types, or nullptr if numpy has not been imported
+     */
+    static const NumpyScalarTypes* instance() noexcept
+    {
+        static std::atomic<const NumpyScalarTypes*> published { nullptr };
+        const NumpyScalarTypes* types = published.load(std::memory_order_acquire);
+        if (types != nullptr) {
+            return types;
+        }
+        const NumpyScalarTypes* loaded = load();
+        if (loaded == nullptr) {
+            return nullptr;
+        }
+        if (!published.compare_exchange_strong(
+                types, loaded, std::memory_order_acq_rel, std::memory_order_acquire
+            )) {
+            delete loaded;
+            return types;
+        }
+        return loaded;
+    }
+
+    /// Look up the scalar types and the C types they hold
+    static const NumpyScalarTypes* load() noexcept
+    {
+        PyObject* numpy = PyDict_GetItemString(PyImport_GetModuleDict(), "numpy");
+        PyObject* dtype
+            = numpy == nullptr ? nullptr : PyObject_GetAttrString(numpy, "dtype");
+        if (dtype == nullptr) {
+            PyErr_Clear();
+            return nullptr;
+        }
+
+        // Names missing from this version of numpy are simply skipped
+        auto* types = new NumpyScalarTypes();
+        for (const char* name : NAMES) {
+            PyObject* type = PyObject_GetAttrString(numpy, name);
+            PyObject* descr
+                = type == nullptr ? nullptr : PyObject_CallOneArg(dtype, type);
+            PyObject* code
+                = descr == nullptr ? nullptr : PyObject_GetAttrString(descr, "char");
+            const char* text = code != nullptr && PyUnicode_Check(code)
+                ? PyUnicode_AsUTF8(code)
+                : nullptr;
+            const Reader reader = text == nullptr ? nullptr : reader_for(text[0]);
+            if (reader != nullptr && PyType_Check(type) && !types->contains(type)) {
+                Py_INCREF(type);
+                auto* scalar_type = reinterpret_cast<PyTypeObject*>(type);
+                types->m_entries.push_back({ scalar_type, reader });
+            }
+            Py_XDECREF(code);
+            Py_XDECREF(descr);
+            Py_XDECREF(type);
+            PyErr_Clear();
+        }
+        Py_DECREF(dtype);
+        return types;
+    }
+
+    /// Whether or not a type has already been found
+    bool contains(PyObject* type) const noexcept
+    {
+        for (const Entry& entry : m_entries) {
+            if (reinterpret_cast<PyObject*>(entry.type) == type) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
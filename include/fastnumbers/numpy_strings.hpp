@@ -0,0 +1,207 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+#include <Python.h>
+
+#include "fastnumbers/exception.hpp"
+
+/**
+ * \class NumpyStringArray
+ * \brief Read-only access to the cells of a numpy StringDType array
+ *
+ * The strings are read through the string functions of numpy's C API,
+ * which is looked up at runtime from the capsule numpy exports, so numpy
+ * is neither needed to build fastnumbers nor imported by it. For anything
+ * other than a one-dimensional StringDType array the NumpyStringArray is
+ * empty.
+ */
+class NumpyStringArray {
+public:
+    /**
+     * \brief Prepare to read the strings of a numpy array
+     * \param obj The Python object that might be a StringDType array
+     * \throw exception_is_set If numpy's C API could not be loaded
+     */
+    explicit NumpyStringArray(PyObject* obj) noexcept(false)
+        : m_array(nullptr)
+        , m_load(nullptr)
+        , m_acquire_allocator(nullptr)
+        , m_release_allocator(nullptr)
+    {
+        if (!is_string_array(obj)) {
+            return;
+        }
+        load_api();
+        Py_INCREF(obj);
+        m_array = reinterpret_cast<ArrayFields*>(obj);
+    }
+
+    // Copy and assignment are disallowed
+    NumpyStringArray(const NumpyStringArray&) = delete;
+    NumpyStringArray(NumpyStringArray&&) = delete;
+    NumpyStringArray& operator=(const NumpyStringArray&) = delete;
+
+    /// Release the array
+    ~NumpyStringArray() noexcept { Py_XDECREF(reinterpret_cast<PyObject*>(m_array)); }
+
+    /// Whether or not a string array is being read
+    explicit operator bool() const noexcept { return m_array != nullptr; }
+
+    /// The number of cells in the array
+    Py_ssize_t size() const noexcept
+    {
+        return static_cast<Py_ssize_t>(m_array->dimensions[0]);
+    }
+
+    /**
+     * \brief Call a function with the UTF-8 text of each cell in a range
+     *
+     * numpy's allocator is held once for the whole range, and the text is
+     * given in place rather than copied. Because the allocator is held,
+     * the function must not call into Python (which might read the same
+     * array and wait on the allocator forever), so callers should keep
+     * ranges short and do anything needing Python after this returns.
+     *
+     * \param begin The index of the first cell to read
+     * \param end The index one past the last cell to read
+     * \param function A callable accepting the index and text of each cell,
+     *                 the text being valid only during the call, or
+     *                 std::nullopt if the cell is missing (only possible if
+     *                 the dtype has an na_object)
+     * \throw exception_is_set If a string could not be unpacked
+     */
+    template <typename Function>
+    void read(const Py_ssize_t begin, const Py_ssize_t end, Function function)
+        noexcept(false)
+    {
+        void* allocator = m_acquire_allocator(m_array->descr);
+        int status = 0;
+        try {
+            for (Py_ssize_t index = begin; index < end; ++index) {
+                const char* packed = m_array->data + (index * m_array->strides[0]);
+                StaticString unpacked { 0, nullptr };
+                status = m_load(allocator, packed, &unpacked);
+                if (status < 0) {
+                    break;
+                }
+                if (status == 1) {
+                    function(index, std::nullopt);
+                } else {
+                    function(index, std::string_view(unpacked.buf, unpacked.size));
+                }
+            }
+        } catch (...) {
+            m_release_allocator(allocator);
+            throw;
+        }
+        m_release_allocator(allocator);
+
+        if (status < 0) {
+            PyErr_SetString(
+                PyExc_RuntimeError, "unable to unpack a string of a StringDType array"
+            );
+            throw exception_is_set();
+        }
+    }
+
+private:
+    /// The leading fields of a numpy array, which are part of numpy's stable ABI
+    struct ArrayFields {
+        PyObject_HEAD
+        char* data;
+        int nd;
+        Py_intptr_t* dimensions;
+        Py_intptr_t* strides;
+        PyObject* base;
+        PyObject* descr;
+    };
+
+    /// An unpacked view of one string, as numpy's npy_static_string
+    struct StaticString {
+        std::size_t size;
+        const char* buf;
+    };
+
+    /// The slots of numpy's C API table holding the string functions,
+    /// as assigned by numpy 2.0 (see numpy/__multiarray_api.h)
+    static constexpr std::size_t NPYSTRING_LOAD = 313;
+    static constexpr std::size_t NPYSTRING_ACQUIRE_ALLOCATOR = 316;
+    static constexpr std::size_t NPYSTRING_RELEASE_ALLOCATOR = 318;
+
+    /// Whether or not the object is a one-dimensional StringDType array
+    static bool is_string_array(PyObject* obj) noexcept
+    {
+        // A numpy array cannot exist unless numpy has already been imported
+        PyObject* numpy = PyDict_GetItemString(PyImport_GetModuleDict(), "numpy");
+        if (numpy == nullptr) {
+            return false;
+        }
+        PyObject* ndarray = PyObject_GetAttrString(numpy, "ndarray");
+        PyObject* dtypes = PyObject_GetAttrString(numpy, "dtypes");
+        PyObject* string_dtype = dtypes == nullptr
+            ? nullptr
+            : PyObject_GetAttrString(dtypes, "StringDType");
+        Py_XDECREF(dtypes);
+
+        // Before numpy 2.0 there was no StringDType
+        bool result = false;
+        if (ndarray != nullptr && string_dtype != nullptr && PyType_Check(ndarray)
+            && PyObject_TypeCheck(obj, reinterpret_cast<PyTypeObject*>(ndarray))) {
+            const auto* fields = reinterpret_cast<const ArrayFields*>(obj);
+            result = fields->nd == 1
+                && reinterpret_cast<PyObject*>(Py_TYPE(fields->descr)) == string_dtype;
+        }
+        PyErr_Clear();
+        Py_XDECREF(ndarray);
+        Py_XDECREF(string_dtype);
+        return result;
+    }
+
+    /// Look up the string functions in numpy's C API table
+    void load_api() noexcept(false)
+    {
+        PyObject* module = PyImport_ImportModule("numpy._core._multiarray_umath");
+        if (module == nullptr) {
+            throw exception_is_set();
+        }
+        PyObject* capsule = PyObject_GetAttrString(module, "_ARRAY_API");
+        Py_DECREF(module);
+        if (capsule == nullptr) {
+            throw exception_is_set();
+        }
+        void** api = static_cast<void**>(PyCapsule_GetPointer(capsule, nullptr));
+        Py_DECREF(capsule); // The table is owned by the module, not the capsule
+        if (api == nullptr) {
+            throw exception_is_set();
+        }
+        m_load = reinterpret_cast<LoadFunction>(api[NPYSTRING_LOAD]);
+        m_acquire_allocator
+            = reinterpret_cast<AcquireFunction>(api[NPYSTRING_ACQUIRE_ALLOCATOR]);
+        m_release_allocator
+            = reinterpret_cast<ReleaseFunction>(api[NPYSTRING_RELEASE_ALLOCATOR]);
+    }
+
+    /// NpyString_load
+    using LoadFunction = int (*)(void*, const void*, StaticString*);
+
+    /// NpyString_acquire_allocator
+    using AcquireFunction = void* (*)(const void*);
+
+    /// NpyString_release_allocator
+    using ReleaseFunction = void (*)(void*);
+
+    /// The array being read (nullptr if it is not a StringDType array)
+    ArrayFields* m_array;
+
+    /// Unpack a string, given the allocator of the array
+    LoadFunction m_load;
+
+    /// Lock the allocator of a StringDType descriptor
+    AcquireFunction m_acquire_allocator;
+
+    /// Unlock an allocator
+    ReleaseFunction m_release_allocator;
+};
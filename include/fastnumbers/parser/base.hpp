@@ -214,4 +214,100 @@ protected:
         }
         return static_cast<T1>(value);
     }
+
+    /// Helper for scaling an integer by a power of ten, checking for overflow
+    /// and for non-zero digits that would be lost
+    template <typename T, typename std::enable_if_t<std::is_integral_v<T>, bool> = true>
+    static RawPayload<T> scale_integer(T value, const int scale) noexcept
+    {
+        constexpr T max_value = std::numeric_limits<T>::max() / 10;
+        constexpr T min_value = std::numeric_limits<T>::min() / 10;
+        for (int i = 0; i < scale && value != 0; ++i) {
+            if (value > max_value || value < min_value) {
+                return ErrorType::OVERFLOW_;
+            }
+            value = static_cast<T>(value * 10);
+        }
+        for (int i = 0; i > scale && value != 0; --i) {
+            if (value % 10 != 0) {
+                return ErrorType::BAD_VALUE;
+            }
+            value = static_cast<T>(value / 10);
+        }
+        return value;
+    }
+
+    /// Helper for creating a scaled integer from the decomposition of a string
+    template <typename T, typename std::enable_if_t<std::is_integral_v<T>, bool> = true>
+    static RawPayload<T> scaled_int_from_checker(
+        const StringChecker& checker, const bool is_negative, const int scale
+    ) noexcept
+    {
+        if (checker.is_invalid()) {
+            return ErrorType::BAD_VALUE;
+        }
+        bool inexact;
+        bool overflow;
+        const T result
+            = parse_scaled_int<T>(checker, is_negative, scale, inexact, overflow);
+        if (inexact) {
+            return ErrorType::BAD_VALUE;
+        } else if (overflow) {
+            return ErrorType::OVERFLOW_;
+        }
+        return result;
+    }
+
+    /// Helper for creating an integer from the decomposition of a string
+    /// containing a float, using the given float-to-int mode
+    template <typename T, typename std::enable_if_t<std::is_integral_v<T>, bool> = true>
+    static RawPayload<T> rounded_int_from_checker(
+        const StringChecker& checker, const bool is_negative, const FloatToInt mode
+    ) noexcept
+    {
+        // Int-like floats (e.g. "3.0" or "1.5e3") are detected without
+        // needing to look at the digits that would be lost
+        const bool intlike_only = mode == FloatToInt::INTLIKE;
+        if (checker.is_invalid() || (intlike_only && checker.is_float())) {
+            return ErrorType::BAD_VALUE;
+        }
+        bool inexact;
+        bool overflow;
+        const bool round = mode == FloatToInt::ROUND;
+        const T result
+            = parse_scaled_int<T>(checker, is_negative, 0, inexact, overflow, round);
+        if (intlike_only && inexact) {
+            return ErrorType::BAD_VALUE;
+        } else if (overflow) {
+            return ErrorType::OVERFLOW_;
+        }
+        return result;
+    }
+
+    /// Helper for converting a double to an integer using the given
+    /// float-to-int mode, checking for overflow
+    template <typename T, typename std::enable_if_t<std::is_integral_v<T>, bool> = true>
+    static RawPayload<T>
+    rounded_int_from_double(double value, const FloatToInt mode) noexcept
+    {
+        if (!std::isfinite(value)) {
+            return ErrorType::BAD_VALUE;
+        } else if (mode == FloatToInt::TRUNCATE) {
+            value = std::trunc(value);
+        } else if (mode == FloatToInt::ROUND) {
+            value = std::nearbyint(value); // ties to even in the default mode
+        } else if (!float_is_intlike(value)) {
+            return ErrorType::BAD_VALUE;
+        }
+
+        // The limits of integer types are powers of two (or one less),
+        // so both bounds are exact as a double
+        constexpr T min_value = std::numeric_limits<T>::min();
+        constexpr T max_value = std::numeric_limits<T>::max();
+        const double upper = static_cast<double>(max_value) + 1.0;
+        if (value < static_cast<double>(min_value) || value >= upper) {
+            return ErrorType::OVERFLOW_;
+        }
+        return static_cast<T>(value);
+    }
 };
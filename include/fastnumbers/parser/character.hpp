@@ -74,6 +74,12 @@ public:
         return str != m_start && str == (m_start + m_str_len);
     }
 
+    /// Exactly compare the magnitude of the (finite) number with that of a double
+    int compare_magnitude(const double value) const noexcept(false)
+    {
+        return ::compare_magnitude(m_start, end(), value);
+    }
+
     /**
      * \brief Convert the contained value into a number C++
      *
@@ -118,6 +124,58 @@ public:
         return static_cast<T>(result);
     }
 
+    /**
+     * \brief Convert the contained value into an integer scaled by
+     *        the power of ten given in the options
+     *
+     * The decimal digits are used exactly, so "12.34" at scale 2 is 1234.
+     * Losing a non-zero digit is an error, as is overflowing the type.
+     */
+    template <typename T, typename std::enable_if_t<std::is_integral_v<T>, bool> = true>
+    RawPayload<T> as_scaled_number() const noexcept(false)
+    {
+        const StringChecker checker(m_start, end(), 10);
+
+        // If invalid because of underscores, remove them and re-check
+        if (checker.is_invalid() && has_valid_underscores()) {
+            Buffer buffer(m_start, m_str_len);
+            buffer.remove_valid_underscores();
+            const StringChecker checker_(buffer.start(), buffer.end(), 10);
+            return scaled_int_from_checker<T>(
+                checker_, is_negative(), options().get_scale()
+            );
+        }
+        return scaled_int_from_checker<T>(checker, is_negative(), options().get_scale());
+    }
+
+    /**
+     * \brief Convert the contained value into an integer, converting a float
+     *        according to the float-to-int mode given in the options
+     *
+     * The decimal digits are used exactly, so "2.5000000000000001" rounds
+     * to 3 even though the closest double is exactly 2.5.
+     */
+    template <typename T, typename std::enable_if_t<std::is_integral_v<T>, bool> = true>
+    RawPayload<T> as_rounded_number() const noexcept(false)
+    {
+        // A float can only be written in base 10
+        if (options().get_base() != 10) {
+            return ErrorType::BAD_VALUE;
+        }
+
+        const FloatToInt mode = options().float_to_int();
+        const StringChecker checker(m_start, end(), 10);
+
+        // If invalid because of underscores, remove them and re-check
+        if (checker.is_invalid() && has_valid_underscores()) {
+            Buffer buffer(m_start, m_str_len);
+            buffer.remove_valid_underscores();
+            const StringChecker checker_(buffer.start(), buffer.end(), 10);
+            return rounded_int_from_checker<T>(checker_, is_negative(), mode);
+        }
+        return rounded_int_from_checker<T>(checker, is_negative(), mode);
+    }
+
     /**
      * \brief Convert the contained value into a number C++
      *
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <cmath>
+#include <limits>
 #include <type_traits>
+#include <variant>
 
 #include <Python.h>
 
 #include "fastnumbers/helpers.hpp"
+#include "fastnumbers/numpy_scalars.hpp"
 #include "fastnumbers/parser/base.hpp"
 #include "fastnumbers/payload.hpp"
 #include "fastnumbers/user_options.hpp"
@@ -20,6 +23,10 @@ public:
     explicit NumericParser(PyObject* obj, const UserOptions& options) noexcept
         : Parser(ParserType::NUMERIC, options)
         , m_obj(obj)
+        , m_scalar(
+              PyFloat_Check(obj) || PyLong_Check(obj) ? NumpyScalar()
+                                                      : NumpyScalarTypes::read(obj)
+          )
     {
         // Store the type of number that was found
         const NumberFlags flags = get_number_type();
@@ -44,13 +51,54 @@ public:
     NumericParser& operator=(const NumericParser&) = default;
     ~NumericParser() = default;
 
+    /**
+     * \brief Is the stored number negative?
+     *
+     * Unlike is_negative(), this works for any numeric type, but
+     * may have to call into Python to find out.
+     */
+    bool is_negative_number() const noexcept
+    {
+        const NumberFlags ntype = get_number_type();
+        if ((ntype & NumberType::Float) && !(ntype & NumberType::User)) {
+            return is_negative();
+        } else if (ntype & NumberType::Float) {
+            const double value = PyFloat_AsDouble(m_obj);
+            if (value == -1.0 && PyErr_Occurred()) {
+                PyErr_Clear();
+                return false;
+            }
+            return value < 0.0;
+        }
+
+        // For integers the overflow flag gives the sign of large values
+        if (const auto* value = std::get_if<long long>(&m_scalar)) {
+            return *value < 0;
+        } else if (std::holds_alternative<unsigned long long>(m_scalar)) {
+            return false;
+        }
+        PyObject* pyint = PyNumber_Long(m_obj);
+        if (pyint == nullptr) {
+            PyErr_Clear();
+            return false;
+        }
+        int overflow = 0;
+        const long long value = PyLong_AsLongLongAndOverflow(pyint, &overflow);
+        Py_DECREF(pyint);
+        if (value == -1 && PyErr_Occurred()) {
+            PyErr_Clear();
+            return false;
+        }
+        return overflow != 0 ? overflow < 0 : value < 0;
+    }
+
     /// Convert the stored object to a python int
     RawPayload<PyObject*> as_pyint() const noexcept(false) override
     {
         if (get_number_type() == static_cast<NumberFlags>(NumberType::INVALID)) {
             return ErrorType::TYPE_ERROR;
         }
-        return PyNumber_Long(m_obj);
+        return to_pyint();
     }
 
     /**
@@ -69,18 +117,18 @@ public:
             if (options().do_denoise() && (get_number_type() & NumberType::IntLike)) {
                 return Parser::float_as_int_without_noise(m_obj);
             } else {
-                return PyNumber_Long(m_obj);
+                return to_pyint();
             }
         } else if (coerce) {
             if (options().do_denoise() && (get_number_type() & NumberType::IntLike)) {
                 return Parser::float_as_int_without_noise(m_obj);
             } else if (get_number_type() & (NumberType::IntLike | NumberType::Integer)) {
-                return PyNumber_Long(m_obj);
+                return to_pyint();
             } else {
-                return PyNumber_Float(m_obj);
+                return to_pyfloat();
             }
         } else {
-            return PyNumber_Float(m_obj);
+            return to_pyfloat();
         }
     }
 
@@ -98,6 +146,10 @@ public:
             return float_properties(get_double(), NumberType::Float);
         } else if (PyLong_Check(m_obj)) {
             return flag_wrap(NumberType::Integer);
+        } else if (std::holds_alternative<double>(m_scalar)) {
+            return float_properties(get_double(), NumberType::Float);
+        } else if (!std::holds_alternative<std::monostate>(m_scalar)) {
+            return flag_wrap(NumberType::Integer);
         }
 
         // In addition to being strictly a float or long, an object can
@@ -143,10 +195,13 @@ public:
 
             // Otherwise use the Python conversion function - this should handle
             // converting integers to double as well. Watch out for errors here too.
-            const double value = PyFloat_AsDouble(m_obj);
-            if (value == -1.0 && PyErr_Occurred()) {
-                PyErr_Clear();
-                return ErrorType::BAD_VALUE;
+            double value = 0.0;
+            if (!scalar_as_double(value)) {
+                value = PyFloat_AsDouble(m_obj);
+                if (value == -1.0 && PyErr_Occurred()) {
+                    PyErr_Clear();
+                    return ErrorType::BAD_VALUE;
+                }
             }
 
             // Don't worry about overflow on casting to a smaller type because
@@ -169,6 +224,13 @@ public:
                 return err;
             };
 
+            // The value of a numpy integer is already known
+            if (const auto* value = std::get_if<long long>(&m_scalar)) {
+                return scalar_in_range<T>(*value);
+            } else if (const auto* value = std::get_if<unsigned long long>(&m_scalar)) {
+                return scalar_in_range<T>(*value);
+            }
+
             // Use special logic for the largest types, otherwise use a generic logic.
             if constexpr (std::is_same_v<T, long long>) {
                 return check_for_error_py<long long>(
@@ -194,6 +256,72 @@ public:
         }
     }
 
+    /**
+     * \brief Convert the contained value into an integer scaled by
+     *        the power of ten given in the options
+     *
+     * Integers that fit in T are scaled directly. Anything else (e.g. a
+     * float, a decimal.Decimal, or an integer that only fits once scaled
+     * down) is scaled exactly from its string representation, which for
+     * a float is the shortest string that round-trips.
+     */
+    template <typename T, typename std::enable_if_t<std::is_integral_v<T>, bool> = true>
+    RawPayload<T> as_scaled_number() const noexcept
+    {
+        const NumberFlags ntype = get_number_type();
+        if (ntype & NumberType::Integer) {
+            const RawPayload<T> value = as_number<T>();
+            const ErrorType* err = std::get_if<ErrorType>(&value);
+            if (err == nullptr) {
+                return scale_integer(std::get<T>(value), options().get_scale());
+            } else if (*err != ErrorType::OVERFLOW_ || options().get_scale() >= 0) {
+                return *err;
+            }
+        } else if (!(ntype & NumberType::Float)) {
+            return ErrorType::TYPE_ERROR;
+        }
+
+        PyObject* text = PyObject_Str(m_obj);
+        if (text == nullptr) {
+            PyErr_Clear();
+            return ErrorType::BAD_VALUE;
+        }
+        Py_ssize_t len = 0;
+        const char* str = PyUnicode_AsUTF8AndSize(text, &len);
+        if (str == nullptr) {
+            PyErr_Clear();
+            Py_DECREF(text);
+            return ErrorType::BAD_VALUE;
+        }
+        const bool negative = len > 0 && str[0] == '-';
+        const StringChecker checker(str + negative, str + len, 10);
+        const RawPayload<T> result
+            = scaled_int_from_checker<T>(checker, negative, options().get_scale());
+        Py_DECREF(text);
+        return result;
+    }
+
+    /**
+     * \brief Convert the contained value into an integer, converting a float
+     *        according to the float-to-int mode given in the options
+     */
+    template <typename T, typename std::enable_if_t<std::is_integral_v<T>, bool> = true>
+    RawPayload<T> as_rounded_number() const noexcept
+    {
+        if (!(get_number_type() & NumberType::Float)) {
+            return as_number<T>();
+        }
+        double value = 0.0;
+        if (!scalar_as_double(value)) {
+            value = PyFloat_AsDouble(m_obj);
+            if (value == -1.0 && PyErr_Occurred()) {
+                PyErr_Clear();
+                return ErrorType::BAD_VALUE;
+            }
+        }
+        return rounded_int_from_double<T>(value, options().float_to_int());
+    }
+
     /**
      * \brief Convert the contained value into a number C++
      *
@@ -209,9 +337,74 @@ private:
     /// The Python object potentially under analysis
     PyObject* m_obj;
 
+    /// The value of the object if it is a numpy scalar that can be read directly
+    NumpyScalar m_scalar;
+
 private:
     /// Return the object as a double. No error checking is performed.
-    double get_double() const noexcept { return PyFloat_AS_DOUBLE(m_obj); }
+    double get_double() const noexcept
+    {
+        if (const auto* value = std::get_if<double>(&m_scalar)) {
+            return *value;
+        }
+        return PyFloat_AS_DOUBLE(m_obj);
+    }
+
+    /// Store the value of a numpy scalar as a double, if the object is one
+    bool scalar_as_double(double& value) const noexcept
+    {
+        return std::visit(
+            [&value](const auto scalar) -> bool {
+                if constexpr (std::is_same_v<decltype(scalar), const std::monostate>) {
+                    return false;
+                } else {
+                    value = static_cast<double>(scalar);
+                    return true;
+                }
+            },
+            m_scalar
+        );
+    }
+
+    /// Convert the stored object to a Python int
+    PyObject* to_pyint() const noexcept
+    {
+        if (const auto* value = std::get_if<long long>(&m_scalar)) {
+            return PyLong_FromLongLong(*value);
+        } else if (const auto* value = std::get_if<unsigned long long>(&m_scalar)) {
+            return PyLong_FromUnsignedLongLong(*value);
+        }
+        return PyNumber_Long(m_obj);
+    }
+
+    /// Convert the stored object to a Python float
+    PyObject* to_pyfloat() const noexcept
+    {
+        double value = 0.0;
+        if (scalar_as_double(value)) {
+            return PyFloat_FromDouble(value);
+        }
+        return PyNumber_Float(m_obj);
+    }
+
+    /// Pass the value of a numpy integer into T if it fits
+    template <typename T, typename S>
+    static RawPayload<T> scalar_in_range(const S value) noexcept
+    {
+        using Limits = std::numeric_limits<T>;
+        bool fits = false;
+        if constexpr (std::is_signed_v<S> && std::is_signed_v<T>) {
+            fits = value >= Limits::min() && value <= Limits::max();
+        } else if constexpr (std::is_signed_v<S>) {
+            fits = value >= 0 && static_cast<unsigned long long>(value) <= Limits::max();
+        } else {
+            fits = value <= static_cast<std::make_unsigned_t<T>>(Limits::max());
+        }
+        if (!fits) {
+            return ErrorType::OVERFLOW_;
+        }
+        return static_cast<T>(value);
+    }
 
     /// Use the value of the float to add qualifiers
     /// if the float is infinite, NaN, or intlike.
@@ -2,6 +2,7 @@
 
 #include <limits>
 #include <type_traits>
+#include <variant>
 
 #include <Python.h>
 
@@ -122,6 +123,42 @@ public:
         return ErrorType::BAD_VALUE;
     }
 
+    /**
+     * \brief Convert the contained value into an integer scaled by
+     *        the power of ten given in the options
+     *
+     * Only digits can be scaled exactly, other numeric characters are invalid.
+     */
+    template <typename T, typename std::enable_if_t<std::is_integral_v<T>, bool> = true>
+    RawPayload<T> as_scaled_number() const noexcept
+    {
+        return std::visit(
+            overloaded {
+                [this](const T value) -> RawPayload<T> {
+                    return scale_integer(value, options().get_scale());
+                },
+                [](const ErrorType err) -> RawPayload<T> {
+                    return err;
+                },
+            },
+            as_number<T>()
+        );
+    }
+
+    /**
+     * \brief Convert the contained value into an integer, converting a
+     *        non-digit numeric character (e.g. '½') according to the
+     *        float-to-int mode given in the options
+     */
+    template <typename T, typename std::enable_if_t<std::is_integral_v<T>, bool> = true>
+    RawPayload<T> as_rounded_number() const noexcept
+    {
+        if (get_number_type() & NumberType::Float) {
+            return rounded_int_from_double<T>(m_numeric, options().float_to_int());
+        }
+        return as_number<T>();
+    }
+
     /**
      * \brief Convert the contained value into a number C++
      *
@@ -18,6 +18,8 @@ enum class ActionType {
     ERROR_BAD_TYPE_INT, ///< Raise invalid type for int
     ERROR_BAD_TYPE_FLOAT, ///< Raise invalid type for float
     ERROR_ILLEGAL_EXPLICIT_BASE, ///< Raise illegal explict base exception
+    ERROR_INVALID_SCALED_INT, ///< Raise invalid scaled int exception
+    ERROR_SCALED_INT_OVERFLOW, ///< Raise scaled int overflow exception
 };
 
 /// The types of errors this class can encounter
@@ -27,7 +27,10 @@ public:
         , m_nan(Selectors::ALLOWED)
         , m_fail(Selectors::RAISE)
         , m_type_error(Selectors::RAISE)
+        , m_overflow(Selectors::RAISE)
         , m_base(base)
+        , m_scale(0)
+        , m_fail_batched(false)
     { }
 
     /// Copy constructor makes sure to increment references
@@ -36,7 +39,10 @@ public:
         , m_nan(Selectors::incref(rhs.m_nan))
         , m_fail(Selectors::incref(rhs.m_fail))
         , m_type_error(Selectors::incref(rhs.m_type_error))
+        , m_overflow(Selectors::incref(rhs.m_overflow))
         , m_base(rhs.m_base)
+        , m_scale(rhs.m_scale)
+        , m_fail_batched(rhs.m_fail_batched)
     { }
 
     /// Move constructor steals object, no need to re-increment
@@ -45,7 +51,10 @@ public:
         , m_nan(std::exchange(rhs.m_nan, nullptr))
         , m_fail(std::exchange(rhs.m_fail, nullptr))
         , m_type_error(std::exchange(rhs.m_type_error, nullptr))
+        , m_overflow(std::exchange(rhs.m_overflow, nullptr))
         , m_base(std::exchange(rhs.m_base, 0))
+        , m_scale(std::exchange(rhs.m_scale, 0))
+        , m_fail_batched(std::exchange(rhs.m_fail_batched, false))
     { }
 
     // Assignment not allowed
@@ -58,32 +67,65 @@ public:
         Selectors::decref(m_nan);
         Selectors::decref(m_fail);
         Selectors::decref(m_type_error);
+        Selectors::decref(m_overflow);
     };
 
     /// Define how a value of infinity will be interpreted
     void set_inf_action(PyObject* inf_value) noexcept
     {
+        Selectors::decref(m_inf);
         m_inf = Selectors::incref(inf_value);
     }
 
     /// Define how a value of NaN will be interpreted
     void set_nan_action(PyObject* nan_value) noexcept
     {
+        Selectors::decref(m_nan);
         m_nan = Selectors::incref(nan_value);
     }
 
     /// Define how a conversion failure will be interpreted
     void set_fail_action(PyObject* fail_value) noexcept
     {
+        Selectors::decref(m_fail);
         m_fail = Selectors::incref(fail_value);
     }
 
     /// Define how a type error will be interpreted
     void set_type_error_action(PyObject* type_error_value) noexcept
     {
+        Selectors::decref(m_type_error);
         m_type_error = Selectors::incref(type_error_value);
     }
 
+    /// Define how an overflow will be interpreted
+    void set_overflow_action(PyObject* overflow_value) noexcept
+    {
+        Selectors::decref(m_overflow);
+        m_overflow = Selectors::incref(overflow_value);
+    }
+
+    /// Define whether a callable for conversion failure accepts a list of inputs
+    void set_fail_batched(const bool batched) noexcept { m_fail_batched = batched; }
+
+    /// The callable for conversion failure if it accepts a list of inputs,
+    /// otherwise nullptr
+    PyObject* batched_fail_callable() const noexcept
+    {
+        return m_fail_batched && PyCallable_Check(m_fail) ? m_fail : nullptr;
+    }
+
+    /// Whether any action leaves the element out of the output
+    bool skips() const noexcept
+    {
+        return m_inf == Selectors::SKIP || m_nan == Selectors::SKIP
+            || m_fail == Selectors::SKIP || m_type_error == Selectors::SKIP
+            || m_overflow == Selectors::SKIP;
+    }
+
+    /// Define the scale of scaled integers - used in error message generation
+    void set_scale(const int scale) noexcept { m_scale = scale; }
+
     /// Resolve the payload into a Python object
     PyObject* resolve(PyObject* input, const Payload& payload) const noexcept
     {
@@ -125,6 +167,10 @@ public:
                     case ActionType::ERROR_ILLEGAL_EXPLICIT_BASE:
                         return type_error_action(input, atype);
 
+                    // This action is indicative of OverflowErrors
+                    case ActionType::ERROR_SCALED_INT_OVERFLOW:
+                        return overflow_action(input, atype);
+
                     default:
                         return fail_action(input, atype);
                     }
@@ -147,9 +193,18 @@ private:
     /// The desired return action for invalid types
     PyObject* m_type_error;
 
+    /// The desired return action for overflow
+    PyObject* m_overflow;
+
     /// Desired integer base - used in error message generation
     int m_base;
 
+    /// Scale of scaled integers - used in error message generation
+    int m_scale;
+
+    /// Whether a callable for conversion failure accepts a list of inputs
+    bool m_fail_batched;
+
 private:
     /// Increment the refcount of a non-null object, then return the object
     static PyObject* increment_reference(PyObject* obj) noexcept
@@ -182,6 +237,12 @@ private:
         return m_type_error == Selectors::INPUT ? input : m_type_error;
     }
 
+    /// Return the appropriate action for an overflow
+    PyObject* overflow_obj(PyObject* input) const noexcept
+    {
+        return m_overflow == Selectors::INPUT ? input : m_overflow;
+    }
+
     /// Return the appropriate value if infinity was detected
     PyObject* inf_action(PyObject* input, bool negative) const noexcept
     {
@@ -224,6 +285,9 @@ private:
         PyObject* my_fail = fail_obj(input);
         if (my_fail == Selectors::RAISE) {
             return raise_appropriate_exception(input, atype);
+        } else if (my_fail == batched_fail_callable()) {
+            PyErr_Clear();
+            return call_batched_callable_once(my_fail, input);
         }
         return fail_action_impl(input, my_fail);
     }
@@ -235,6 +299,9 @@ private:
         PyObject* my_fail = fail_obj(input);
         if (my_fail == Selectors::RAISE) {
             return nullptr; // an error has already been set
+        } else if (my_fail == batched_fail_callable()) {
+            PyErr_Clear();
+            return call_batched_callable_once(my_fail, input);
         }
         return fail_action_impl(input, my_fail);
     }
@@ -249,6 +316,16 @@ private:
         return fail_action_impl(input, my_type_error);
     }
 
+    /// Return the appropriate value if an overflow occured
+    PyObject* overflow_action(PyObject* input, ActionType atype) const noexcept
+    {
+        PyObject* my_overflow = overflow_obj(input);
+        if (my_overflow == Selectors::RAISE) {
+            return raise_appropriate_exception(input, atype);
+        }
+        return fail_action_impl(input, my_overflow);
+    }
+
     /// Implementation for non-raising fail action
     PyObject* fail_action_impl(PyObject* input, PyObject* actionable) const noexcept
     {
@@ -301,6 +378,26 @@ private:
             );
             break;
 
+        case ActionType::ERROR_INVALID_SCALED_INT:
+            // Raise an exception due to a number that cannot be scaled exactly
+            PyErr_Format(
+                PyExc_ValueError,
+                "could not convert %.200R to an integer with scale %d",
+                input,
+                m_scale
+            );
+            break;
+
+        case ActionType::ERROR_SCALED_INT_OVERFLOW:
+            // Raise an exception due to a scaled number too large for 64 bits
+            PyErr_Format(
+                PyExc_OverflowError,
+                "%.200R with scale %d does not fit in a signed 64-bit integer",
+                input,
+                m_scale
+            );
+            break;
+
         default:
             // ERROR_ILLEGAL_EXPLICIT_BASE
             // ERROR_INVALID_BASE
@@ -34,13 +34,24 @@ struct Selectors {
     /// Selector to only allow numbers
     static PyObject* NUMBER_ONLY;
 
+    /// Selector to saturate to the limits of the output type
+    static PyObject* CLAMP;
+
+    /// Selector to leave the element out of the output
+    static PyObject* SKIP;
+
+    /// Placeholder for a result that is resolved later (never given to the user)
+    static PyObject* PENDING;
+
     static bool is_selector(PyObject* obj) noexcept
     {
         return obj == Selectors::POS_INFINITY || obj == Selectors::NEG_INFINITY
             || obj == Selectors::POS_NAN || obj == Selectors::NEG_NAN
             || obj == Selectors::ALLOWED || obj == Selectors::DISALLOWED
             || obj == Selectors::INPUT || obj == Selectors::RAISE
-            || obj == Selectors::STRING_ONLY || obj == Selectors::NUMBER_ONLY;
+            || obj == Selectors::STRING_ONLY || obj == Selectors::NUMBER_ONLY
+            || obj == Selectors::CLAMP || obj == Selectors::SKIP
+            || obj == Selectors::PENDING;
     }
 
     /// Increment a Python object's reference count if the object is not a selector
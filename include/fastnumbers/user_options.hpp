@@ -13,6 +13,15 @@ enum class UserType {
     INT, ///< Convert to/check an int
     INTLIKE, ///< Check int-like
     FORCEINT, ///< Force conversion to int
+    SCALED_INT, ///< Convert to an int scaled by a power of ten
+};
+
+/// How a float is written into a C integer type
+enum class FloatToInt {
+    RAISE, ///< Floats are invalid input
+    TRUNCATE, ///< Round toward zero
+    ROUND, ///< Round to nearest, ties to even
+    INTLIKE, ///< Only accept floats with no fractional component
 };
 
 /**
@@ -32,6 +41,8 @@ public:
         , m_inf_allowed_str(false)
         , m_inf_allowed_num(false)
         , m_unicode_allowed(true)
+        , m_scale(std::numeric_limits<int>::min())
+        , m_float_to_int(FloatToInt::RAISE)
     { }
     UserOptions(const UserOptions&) = default;
     UserOptions(UserOptions&&) = default;
@@ -148,6 +159,25 @@ public:
     /// Indicate if we allow non-ASCII unicode characters as input
     bool allow_unicode() const noexcept { return m_unicode_allowed; }
 
+    /// Tell the analyzer the power of ten by which to scale integers,
+    /// use INT_MIN for no scaling
+    void set_scale(const int scale) noexcept { m_scale = scale; }
+
+    /// Get the stored scale
+    int get_scale() const noexcept { return m_scale; }
+
+    /// Should numbers be parsed as an integer scaled by a power of ten?
+    bool is_scaled() const noexcept
+    {
+        return m_scale != std::numeric_limits<int>::min();
+    }
+
+    /// Tell the analyzer how floats are converted to C integers
+    void set_float_to_int(const FloatToInt mode) noexcept { m_float_to_int = mode; }
+
+    /// How floats are converted to C integers
+    FloatToInt float_to_int() const noexcept { return m_float_to_int; }
+
 private:
     /// The desired base of integers when parsing
     int m_base;
@@ -179,4 +209,10 @@ private:
 
     /// Whether or not a unicode character is allowed
     bool m_unicode_allowed;
+
+    /// The power of ten by which to scale integers (INT_MIN if not scaled)
+    int m_scale;
+
+    /// How floats are converted to C integers
+    FloatToInt m_float_to_int;
 };
\ No newline at end of file
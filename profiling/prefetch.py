@@ -0,0 +1,71 @@
+#! /usr/bin/env python
+"""Measure the throughput of converting large lists of shuffled strings.
+
+When a list is large, its strings are scattered across far more memory than
+fits in cache, and converting them is dominated by waiting on memory. Build
+fastnumbers with different values of FN_PREFETCH_DISTANCE in the environment
+(0 disables prefetching) and compare the results of this script.
+
+Give the list sizes in millions as arguments (default 1 and 10). Note that
+every million strings takes roughly 100 MB of memory.
+"""
+
+from __future__ import annotations
+
+import random
+import sys
+import time
+
+import fastnumbers
+
+try:
+    import numpy as np
+except ImportError:  # pragma: no cover
+    np = None
+
+
+def make_strings(n):
+    """Create n float strings, shuffled so neighbors are not neighbors in memory."""
+    rng = random.Random(42)
+    strings = [repr(rng.uniform(-1e6, 1e6)) for _ in range(n)]
+    rng.shuffle(strings)
+    return strings
+
+
+def best_time(func, data, *, repeat=3):
+    """Return the best wall time of calling func on data."""
+    best = float("inf")
+    for _ in range(repeat):
+        start = time.perf_counter()
+        func(data)
+        best = min(best, time.perf_counter() - start)
+    return best
+
+
+def main():
+    """Time each workload for each list size and print a Markdown table."""
+    sizes = [int(float(x) * 1_000_000) for x in sys.argv[1:]] or [1_000_000, 10_000_000]
+    workloads = [
+        ("try_float(x, map=list)", lambda x: fastnumbers.try_float(x, map=list))
+    ]
+    if np is not None:
+        workloads.append(("try_array(x)", fastnumbers.try_array))
+
+    print(f"### Shuffled String Lists (Python {sys.version.split()[0]})")
+    print()
+    header = ["Workload"] + [f"{n / 1e6:g}M strings (Mconv/s)" for n in sizes]
+    rows = {label: [label] for label, _ in workloads}
+    for n in sizes:
+        data = make_strings(n)
+        for label, func in workloads:
+            rows[label].append(f"{n / best_time(func, data) / 1e6:.2f}")
+        del data
+
+    print("| " + " | ".join(header) + " |")
+    print("| " + " | ".join("-" * (len(x) - 1) + ":" for x in header) + " |")
+    for row in rows.values():
+        print("| " + " | ".join(row) + " |")
+
+
+if __name__ == "__main__":
+    main()
@@ -5,6 +5,7 @@ from __future__ import annotations
 
 import copy
 import decimal
+import functools
 import gc
 import math
 import re
@@ -434,6 +435,30 @@ timer.add_function("float_re", "regex", "from __main__ import float_re")
 timer.add_function("try_float", "fastnumbers", "from fastnumbers import try_float")
 timer.time_functions()
 
+timer = Timer(
+    "Timing comparison of scalar calls with a single positional argument "
+    "vs. with keyword arguments"
+)
+timer.add_function(
+    "try_float", "try_float(x)", setup="from fastnumbers import try_float"
+)
+timer.add_function(
+    "try_float_kw",
+    "try_float(x, on_fail=INPUT)",
+    setup="from functools import partial; from fastnumbers import INPUT, try_float; "
+    "try_float_kw = partial(try_float, on_fail=INPUT)",
+)
+timer.add_function(
+    "fast_float", "fast_float(x)", setup="from fastnumbers import fast_float"
+)
+timer.add_function(
+    "fast_float_kw",
+    "fast_float(x, default=None)",
+    setup="from functools import partial; from fastnumbers import fast_float; "
+    "fast_float_kw = partial(fast_float, default=None)",
+)
+timer.time_functions()
+
 timer = Timer(
     "Timing comparison of `float` (but coerce to `int` if possible) "
     "functions with error handling"
@@ -550,3 +575,26 @@ timer.add_function(
     iterable=True,
 )
 timer.time_functions()
+
+# With a large input the time is spent in the loop over the elements rather
+# than in the function call, so time that loop for each kind of container.
+print("### Timing of `try_array` into an existing array for 1,000,000 elements")
+print()
+large_floats = [i / 7 for i in range(1_000_000)]
+large_output = np.empty(len(large_floats), dtype=np.float64)
+table = Table()
+table.add_header("Input type", "try_array(iterable, output) (ms)")
+for label, iterable in (
+    ("List of Float String", [repr(x) for x in large_floats]),
+    ("List of Float", large_floats),
+    ("Tuple of Float", tuple(large_floats)),
+):
+    result = timeit.repeat(
+        functools.partial(fastnumbers.try_array, iterable, large_output),
+        number=1,
+        repeat=10,
+    )
+    mean, stddev = Timer.mean(result) * 1000, Timer.stddev(result) * 1000
+    table.add_row(label, f"{mean:.3f} ± {stddev:.3f}")
+print(str(table))
+print()
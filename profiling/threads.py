@@ -0,0 +1,80 @@
+#! /usr/bin/env python
+"""Measure how fastnumbers throughput scales with the number of threads.
+
+On a free-threaded ("no-GIL") build of Python the throughput should grow
+with the thread count up to the number of available cores. On a regular
+build the GIL serializes the work, so it should stay roughly flat.
+"""
+
+from __future__ import annotations
+
+import concurrent.futures
+import os
+import sys
+import sysconfig
+import time
+
+import fastnumbers
+
+N_CALLS = 200_000
+THREAD_COUNTS = (1, 2, 4, 8)
+STRINGS = ["-41053.543034e34", "not_a_number", "-4.1", "358924829458"] * 25
+
+
+def scalar_work(n):
+    """Call try_float once per element."""
+    try_float = fastnumbers.try_float
+    data = STRINGS
+    for _ in range(n // len(data)):
+        for x in data:
+            try_float(x)
+
+
+def list_work(n):
+    """Convert whole lists with the map option."""
+    try_float = fastnumbers.try_float
+    data = STRINGS * 10
+    for _ in range(n // len(data)):
+        try_float(data, map=list)
+
+
+def run(work, nthreads, *, repeat=3):
+    """Return the best total number of conversions per second."""
+    best = 0.0
+    with concurrent.futures.ThreadPoolExecutor(max_workers=nthreads) as pool:
+        for _ in range(repeat):
+            start = time.perf_counter()
+            futures = [pool.submit(work, N_CALLS) for _ in range(nthreads)]
+            for future in futures:
+                future.result()
+            elapsed = time.perf_counter() - start
+            best = max(best, nthreads * N_CALLS / elapsed)
+    return best
+
+
+def main():
+    """Time each workload for each thread count and print a Markdown table."""
+    gil_disabled = bool(sysconfig.get_config_var("Py_GIL_DISABLED"))
+    gil_enabled = getattr(sys, "_is_gil_enabled", lambda: True)()
+    print(f"### Thread Scaling (Python {sys.version.split()[0]})")
+    print()
+    print(f"- Free-threaded build: {gil_disabled}")
+    print(f"- GIL enabled at runtime: {gil_enabled}")
+    print(f"- CPU count: {os.cpu_count()}")
+    print()
+
+    header = ["Workload"] + [f"{n} thread(s) (Mconv/s)" for n in THREAD_COUNTS]
+    rows = []
+    for label, work in (("try_float(x)", scalar_work), ("map=list", list_work)):
+        rates = [run(work, n) for n in THREAD_COUNTS]
+        cells = [f"{rate / 1e6:.2f} ({rate / rates[0]:.1f}x)" for rate in rates]
+        rows.append([label, *cells])
+
+    print("| " + " | ".join(header) + " |")
+    print("| " + " | ".join("-" * (len(x) - 1) + ":" for x in header) + " |")
+    for row in rows:
+        print("| " + " | ".join(row) + " |")
+
+
+if __name__ == "__main__":
+    main()
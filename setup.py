@@ -40,12 +40,20 @@ else:
     if "FN_WARNINGS_AS_ERRORS" in os.environ:
         compile_args.append("-Werror")
 
+# Optionally tune how far ahead list elements are prefetched (0 disables)
+define_macros = []
+if "FN_PREFETCH_DISTANCE" in os.environ:
+    define_macros.append(
+        ("FN_PREFETCH_DISTANCE", str(int(os.environ["FN_PREFETCH_DISTANCE"])))
+    )
+
 
 ext = [
     Extension(
         "fastnumbers.fastnumbers",
         sorted(map(str, pathlib.Path("src/cpp").glob("*.cpp"))),
         include_dirs=[str(pathlib.Path("include").resolve())],
+        define_macros=define_macros,
         extra_compile_args=compile_args,
         extra_link_args=link_args,
         language="c++",
@@ -150,7 +150,6 @@ static int initialize_keywords(
      */
     cache->nargs = nargs;
     cache->npositional_only = npositional_only;
-    cache->npositional = npositional;
     cache->nrequired = nrequired;
 
     /* NULL kw_strings for easier cleanup (and NULL termination) */
@@ -177,26 +176,55 @@ static int initialize_keywords(
     }
 
     va_end(va);
+
+    /* Publish the cache only once everything else has been written */
+    cache->npositional.store(npositional, std::memory_order_release);
     return 0;
 
 error:
     for (int i = 0; i < nkwargs; i++) {
         Py_XDECREF(cache->kw_strings[i]);
     }
-    cache->npositional = -1; /* not initialized */
     return -1;
 }
 
+/**
+ * Initialize the cache exactly once, even if called concurrently.
+ *
+ * @param funcname Name of the function, mainly used for errors.
+ * @param cache A cache object stored statically in the parsing function
+ * @param va_orig Argument list to npy_parse_arguments
+ * @return 0 on success, -1 on failure
+ */
+static int ensure_keywords_initialized(
+    const char* funcname, _FNArgParserCache* cache, va_list va_orig
+) noexcept
+{
+    int res = 0;
+#ifdef Py_GIL_DISABLED
+    PyMutex_Lock(&cache->mutex);
+    /* Another thread may have finished initialization while we waited */
+    if (cache->npositional.load(std::memory_order_acquire) == -1) {
+        res = initialize_keywords(funcname, cache, va_orig);
+    }
+    PyMutex_Unlock(&cache->mutex);
+#else
+    res = initialize_keywords(funcname, cache, va_orig);
+#endif
+    return res;
+}
+
 static int raise_incorrect_number_of_positional_args(
     const char* funcname, const _FNArgParserCache* cache, Py_ssize_t len_args
 ) noexcept
 {
-    if (cache->npositional == cache->nrequired) {
+    const int npositional = cache->npositional.load(std::memory_order_relaxed);
+    if (npositional == cache->nrequired) {
         PyErr_Format(
             PyExc_TypeError,
             "%s() takes %d positional arguments but %zd were given",
             funcname,
-            cache->npositional,
+            npositional,
             len_args
         );
     } else {
@@ -206,7 +234,7 @@ static int raise_incorrect_number_of_positional_args(
             "%zd were given",
             funcname,
             cache->nrequired,
-            cache->npositional,
+            npositional,
             len_args
         );
     }
@@ -258,18 +286,18 @@ int _fn_parse_arguments(
     ...
 ) noexcept
 {
-    if (cache->npositional == -1) {
+    if (cache->npositional.load(std::memory_order_acquire) == -1) {
         va_list va;
         va_start(va, kwnames);
 
-        int res = initialize_keywords(funcname, cache, va);
+        int res = ensure_keywords_initialized(funcname, cache, va);
         va_end(va);
         if (res < 0) {
             return -1;
         }
     }
 
-    if (len_args > cache->npositional) {
+    if (len_args > cache->npositional.load(std::memory_order_relaxed)) {
         return raise_incorrect_number_of_positional_args(funcname, cache, len_args);
     }
 
@@ -10,7 +10,9 @@
 #include <charconv>
 #include <cmath>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
+#include <string>
 
 /*********************/
 /* EXPOSED FUNCTIONS */
@@ -151,7 +153,7 @@ StringChecker::StringChecker(const char* str, const char* end, int base) noexcep
 void remove_valid_underscores(char* str, const char*& end, const bool based) noexcept
 {
     // Ignore a leading negative sign
-    if (*str == '-') {
+    if (str != end && *str == '-') {
         str += 1;
     }
 
@@ -225,3 +227,111 @@ void remove_valid_underscores(char* str, const char*& end, const bool based) noe
         str[i] = '\0';
     }
 }
+
+/// Multiply the little-endian decimal digits by a factor no larger than 2**32
+static void multiply_digits(std::string& digits, const uint64_t factor)
+{
+    uint64_t carry = 0;
+    for (char& digit : digits) {
+        carry += static_cast<uint64_t>(digit) * factor;
+        digit = static_cast<char>(carry % 10);
+        carry /= 10;
+    }
+    for (; carry != 0; carry /= 10) {
+        digits.push_back(static_cast<char>(carry % 10));
+    }
+}
+
+/// Remove leading and trailing zeros from the big-endian decimal digits of
+/// the number digits * 10**exponent, keeping the exponent in step
+static void normalize_digits(std::string& digits, int64_t& exponent)
+{
+    const std::size_t last = digits.find_last_not_of('0');
+    if (last == std::string::npos) {
+        digits.clear();
+        return;
+    }
+    exponent += static_cast<int64_t>(digits.size() - last - 1);
+    digits.erase(last + 1);
+    digits.erase(0, digits.find_first_not_of('0'));
+}
+
+int compare_magnitude(const char* str, const char* end, const double value) noexcept(
+    false
+)
+{
+    // The text is digits * 10**exponent. The exponent saturates, as any
+    // exponent that large is nowhere near the range of a double.
+    constexpr int64_t exponent_limit = 1'000'000'000'000'000;
+    std::string text_digits;
+    int64_t text_exponent = 0;
+    bool in_fraction = false;
+    for (; str != end; ++str) {
+        if (is_valid_digit(*str)) {
+            text_digits.push_back(*str);
+            text_exponent -= static_cast<int64_t>(in_fraction);
+        } else if (*str == '.') {
+            in_fraction = true;
+        } else if (*str == 'e' || *str == 'E') {
+            str += 1;
+            const bool negative = str != end && *str == '-';
+            str += static_cast<std::size_t>(str != end && is_sign(*str));
+            int64_t explicit_exponent = 0;
+            for (; str != end; ++str) {
+                if (is_valid_digit(*str)) {
+                    explicit_exponent = std::min(
+                        explicit_exponent * 10 + to_digit<int64_t>(*str), exponent_limit
+                    );
+                }
+            }
+            text_exponent += negative ? -explicit_exponent : explicit_exponent;
+            break;
+        }
+    }
+    normalize_digits(text_digits, text_exponent);
+
+    // The double is an odd integer times a power of two, which is
+    // exactly the decimal digits * 10**exponent found from powers of 5 or 2
+    int binary_exponent = 0;
+    const double fraction = std::frexp(std::fabs(value), &binary_exponent);
+    auto mantissa = static_cast<uint64_t>(std::ldexp(fraction, 53));
+    binary_exponent -= 53;
+    std::string value_digits;
+    int64_t value_exponent = 0;
+    if (mantissa != 0) {
+        for (; (mantissa & 1U) == 0; mantissa >>= 1U) {
+            binary_exponent += 1;
+        }
+        for (; mantissa != 0; mantissa /= 10) {
+            value_digits.push_back(static_cast<char>(mantissa % 10));
+        }
+        const uint64_t base = binary_exponent < 0 ? 5 : 2;
+        int remaining = std::abs(binary_exponent);
+        for (; remaining >= 13; remaining -= 13) {
+            multiply_digits(value_digits, base == 5 ? 1220703125 : 8192);
+        }
+        for (; remaining > 0; --remaining) {
+            multiply_digits(value_digits, base);
+        }
+        value_exponent = std::min(binary_exponent, 0);
+        std::reverse(value_digits.begin(), value_digits.end());
+        for (char& digit : value_digits) {
+            digit = static_cast<char>(digit + '0');
+        }
+        normalize_digits(value_digits, value_exponent);
+    }
+
+    // Compare zero, then the order of magnitude, then the digits themselves
+    if (text_digits.empty() || value_digits.empty()) {
+        return static_cast<int>(!text_digits.empty()) - !value_digits.empty();
+    }
+    const int64_t text_order
+        = static_cast<int64_t>(text_digits.size()) + text_exponent;
+    const int64_t value_order
+        = static_cast<int64_t>(value_digits.size()) + value_exponent;
+    if (text_order != value_order) {
+        return text_order < value_order ? -1 : 1;
+    }
+    const int comparison = text_digits.compare(value_digits);
+    return (comparison > 0) - (comparison < 0);
+}
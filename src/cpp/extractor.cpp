@@ -61,22 +61,14 @@ extract_parser(PyObject* obj, Buffer& buffer, const UserOptions& options) noexce
     // handling compared to the above.
     Py_buffer view = { nullptr, nullptr };
     if (PyObject_CheckBuffer(obj) && PyObject_GetBuffer(obj, &view, PyBUF_SIMPLE) == 0) {
-        // NOTE: PyBUF_SIMPLE implies zero-dimensional byte data.
-        // This buffer could be a memoryview slice. If this is the case, the
-        // nul termination of the string will be past the given length, creating
-        // unexpected parsing results. Rather than complicate the parsing and
-        // adding more operations for a low probability event, a copy of the
-        // slice will be made here and null termination will be added.
+        // NOTE: PyBUF_SIMPLE implies contiguous one-dimensional byte data.
+        // This buffer could be a memoryview slice (e.g. of an mmap), which is
+        // not nul-terminated, but the parser never reads past the given length
+        // so the data is parsed in place without a copy. The data need not
+        // belong to obj, so the view is held by the buffer (which outlives the
+        // parser) rather than released here.
         const std::size_t len = static_cast<const std::size_t>(view.len);
-        buffer.reserve(len + 1);
-        PyBuffer_ToContiguous(buffer.start(), &view, len, 'A');
-        buffer.start()[len] = '\0';
-
-        // All we care about is the underlying buffer data, not the obj
-        // which was allocated when we created the buffer. For this reason
-        // it is safe to release the buffer here.
-        PyBuffer_Release(&view);
-        return CharacterParser(buffer.start(), len, options, false);
+        return CharacterParser(buffer.hold(view), len, options, false);
     }
 
     // If here, we have no idea what the type is. The NumericParser is
@@ -1,6 +1,7 @@
 /*
  * This file contains the functions that directly interface with the Python interpreter.
  */
+#include <algorithm>
 #include <exception>
 #include <functional>
 #include <limits>
@@ -44,6 +45,61 @@ static inline int assess_integer_base_input(PyObject* pybase) noexcept(false)
     return static_cast<int>(longbase);
 }
 
+/**
+ * \brief Function to handle the conversion of scale to integers.
+ *
+ * Scales too large for an int are clamped - they are already far past
+ * the point where any non-zero number overflows or loses digits.
+ *
+ * \param pyscale The scale as a Python object
+ * \return The scale, or INT_MIN if no scale was given
+ * \throws fastnumbers_exception on invalid input
+ */
+static inline int assess_scale_input(PyObject* pyscale) noexcept(false)
+{
+    // Default to std::numeric_limits<int>::min()
+    if (pyscale == nullptr || pyscale == Py_None) {
+        return std::numeric_limits<int>::min();
+    }
+
+    // Convert to int, clamping to a range that excludes the default
+    const Py_ssize_t scale = PyNumber_AsSsize_t(pyscale, nullptr);
+    if (scale == -1 && PyErr_Occurred()) {
+        throw fastnumbers_exception("");
+    }
+    constexpr Py_ssize_t limit = std::numeric_limits<int>::max();
+    return static_cast<int>(std::clamp(scale, -limit, limit));
+}
+
+/**
+ * \brief Function to handle the conversion of float_to_int to a mode.
+ *
+ * \param pymode The mode as a Python object
+ * \return The mode, or FloatToInt::RAISE if no mode was given
+ * \throws fastnumbers_exception on invalid input
+ */
+static inline FloatToInt assess_float_to_int_input(PyObject* pymode) noexcept(false)
+{
+    if (pymode == nullptr) {
+        return FloatToInt::RAISE;
+    }
+    if (PyUnicode_Check(pymode)) {
+        if (PyUnicode_CompareWithASCIIString(pymode, "raise") == 0) {
+            return FloatToInt::RAISE;
+        } else if (PyUnicode_CompareWithASCIIString(pymode, "truncate") == 0) {
+            return FloatToInt::TRUNCATE;
+        } else if (PyUnicode_CompareWithASCIIString(pymode, "round") == 0) {
+            return FloatToInt::ROUND;
+        } else if (PyUnicode_CompareWithASCIIString(pymode, "intlike") == 0) {
+            return FloatToInt::INTLIKE;
+        }
+    }
+    throw fastnumbers_exception(
+        "allowed values for 'float_to_int' are 'raise', 'truncate', 'round', "
+        "or 'intlike'"
+    );
+}
+
 /**
  * \brief Resolve all possible backwards-compatible values for on_fail.
  *
@@ -143,6 +199,98 @@ static PyObject* choose_execution_scheme(
     }
 }
 
+/**
+ * \brief Reject fastnumbers.SKIP as the result of a one-off conversion
+ *
+ * A callable may return SKIP, but there is no element to leave out of
+ * a single result, so as when given as a selector it needs a map.
+ *
+ * \param result The new reference returned by the conversion
+ * \return The result, if it is not SKIP
+ */
+static inline PyObject* reject_skip(PyObject* result) noexcept(false)
+{
+    if (result == Selectors::SKIP) {
+        Py_DECREF(result);
+        throw fastnumbers_exception(
+            "fastnumbers.SKIP is only allowed when map is True or list"
+        );
+    }
+    return result;
+}
+
+/**
+ * \brief Execute the conversion of an Implementation as a one-off or as an iterable
+ *
+ * If a list is requested and the Implementation has a batched callable for
+ * conversion failure, the failures are given to the callable a chunk at a time.
+ *
+ * \param input The input from Python-land
+ * \param impl The Implementation that converts our input to output
+ * \param map If True or list execute as an iterable, otherwise as a one-off
+ * \return The object to return to Python-land
+ */
+static PyObject*
+execute_conversion(PyObject* input, Implementation impl, const PyObject* map) noexcept(
+    false
+)
+{
+    if (map == Py_False) {
+        impl.validate_not_skip();
+        return reject_skip(impl.convert(input));
+    }
+    if (map == (PyObject*)&PyList_Type && impl.batched_fail_callable() != nullptr) {
+        return list_batched_iteration_impl(input, impl);
+    }
+
+    // The elements of a list are converted with one dispatch, so the parser
+    // is only chosen again when the type of the elements changes
+    if (map == (PyObject*)&PyList_Type) {
+        ParserDispatch dispatch;
+        return list_iteration_impl(input, [&impl, &dispatch](PyObject* x) -> PyObject* {
+            return impl.convert(x, dispatch);
+        });
+    }
+
+    // Use a lambda instead of the convert function directly so that the
+    // Implementation object stays in memory even if we return an iterator.
+    auto convert = [impl = std::move(impl)](PyObject* x) -> PyObject* {
+        return impl.convert(x);
+    };
+    return choose_execution_scheme(input, convert, map);
+}
+
+/**
+ * \brief Determine if only the input was given to a function
+ *
+ * If so, every other option has its default value.
+ *
+ * \param len_args The number of positional arguments given
+ * \param kwnames The keyword argument names given, or nullptr
+ */
+static inline bool only_input_given(Py_ssize_t len_args, PyObject* kwnames) noexcept
+{
+    return len_args == 1 && kwnames == nullptr;
+}
+
+/**
+ * \brief Return the Implementation for a function's default options
+ *
+ * When only the input is given every option is at its default, so the
+ * Implementation can be built by the factory on first use and re-used by
+ * every later call instead of being constructed each time. Each factory type
+ * (i.e. each entry point's lambda) gets its own instance. Default options are
+ * all selectors, so destroying it at exit releases no Python references.
+ *
+ * \param make_impl A callable returning the Implementation to cache
+ */
+template <typename Factory>
+static inline const Implementation& cached_default(Factory make_impl) noexcept(false)
+{
+    static const Implementation impl = make_impl();
+    return impl;
+}
+
 /**
  * \brief Quickly convert to an int or float, depending on value, with error handling
  */
@@ -157,6 +305,7 @@ static PyObject* fastnumbers_try_real(
     PyObject* on_type_error = Selectors::RAISE;
     bool coerce = true;
     bool denoise = false;
+    bool batch_on_fail = false;
     bool allow_underscores = false;
     PyObject* map = Py_False;
 
@@ -168,6 +317,7 @@ static PyObject* fastnumbers_try_real(
                            "$inf", false, &inf,
                            "$nan", false, &nan,
                            "$on_fail", false, &on_fail,
+                           "$batch_on_fail", true, &batch_on_fail,
                            "$on_type_error", false, &on_type_error,
                            "$coerce", true, &coerce,
                            "$allow_underscores", true, &allow_underscores,
@@ -179,20 +329,24 @@ static PyObject* fastnumbers_try_real(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        // Use a lambda instead of the convert function directly so that the
-        // Implementation object stays in memory even if we return an iterator.
-        Implementation impl(UserType::REAL);
-        impl.set_fail_action(on_fail);
-        impl.set_type_error_action(on_type_error);
-        impl.set_inf_action(inf);
-        impl.set_nan_action(nan);
-        impl.set_coerce(coerce);
-        impl.set_denoise(denoise);
-        impl.set_underscores_allowed(allow_underscores);
-        auto convert = [impl = std::move(impl)](PyObject* x) -> PyObject* {
-            return impl.convert(x);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::REAL);
+            impl.set_fail_action(on_fail);
+            impl.set_fail_batched(batch_on_fail);
+            impl.set_type_error_action(on_type_error);
+            impl.set_inf_action(inf);
+            impl.set_nan_action(nan);
+            impl.set_coerce(coerce);
+            impl.set_denoise(denoise);
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
         };
-        return choose_execution_scheme(input, convert, normalize_map(map));
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).convert(input);
+        }
+
+        return execute_conversion(input, make_impl(), normalize_map(map));
     });
 }
 
@@ -208,6 +362,7 @@ static PyObject* fastnumbers_try_float(
     PyObject* nan = Selectors::ALLOWED;
     PyObject* on_fail = Selectors::INPUT;
     PyObject* on_type_error = Selectors::RAISE;
+    bool batch_on_fail = false;
     bool allow_underscores = false;
     PyObject* map = Py_False;
 
@@ -219,6 +374,7 @@ static PyObject* fastnumbers_try_float(
                            "$inf", false, &inf,
                            "$nan", false, &nan,
                            "$on_fail", false, &on_fail,
+                           "$batch_on_fail", true, &batch_on_fail,
                            "$on_type_error", false, &on_type_error,
                            "$allow_underscores", true, &allow_underscores,
                            "$map", false, &map,
@@ -228,18 +384,22 @@ static PyObject* fastnumbers_try_float(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        // Use a lambda instead of the convert function directly so that the
-        // Implementation object stays in memory even if we return an iterator.
-        Implementation impl(UserType::FLOAT);
-        impl.set_fail_action(on_fail);
-        impl.set_type_error_action(on_type_error);
-        impl.set_inf_action(inf);
-        impl.set_nan_action(nan);
-        impl.set_underscores_allowed(allow_underscores);
-        auto convert = [impl = std::move(impl)](PyObject* x) -> PyObject* {
-            return impl.convert(x);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::FLOAT);
+            impl.set_fail_action(on_fail);
+            impl.set_fail_batched(batch_on_fail);
+            impl.set_type_error_action(on_type_error);
+            impl.set_inf_action(inf);
+            impl.set_nan_action(nan);
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
         };
-        return choose_execution_scheme(input, convert, normalize_map(map));
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).convert(input);
+        }
+
+        return execute_conversion(input, make_impl(), normalize_map(map));
     });
 }
 
@@ -254,6 +414,7 @@ static PyObject* fastnumbers_try_int(
     PyObject* on_fail = Selectors::INPUT;
     PyObject* on_type_error = Selectors::RAISE;
     PyObject* pybase = nullptr;
+    bool batch_on_fail = false;
     bool allow_underscores = false;
     PyObject* map = Py_False;
 
@@ -263,6 +424,7 @@ static PyObject* fastnumbers_try_int(
     if (fn_parse_arguments("try_int", args, len_args, kwnames,
                            "x", false,  &input,
                            "$on_fail", false, &on_fail,
+                           "$batch_on_fail", true, &batch_on_fail,
                            "$on_type_error", false, &on_type_error,
                            "$base", false, &pybase,
                            "$allow_underscores", true, &allow_underscores,
@@ -273,17 +435,21 @@ static PyObject* fastnumbers_try_int(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        // Use a lambda instead of the convert function directly so that the
-        // Implementation object stays in memory even if we return an iterator.
-        Implementation impl(UserType::INT, assess_integer_base_input(pybase));
-        impl.set_fail_action(on_fail);
-        impl.set_type_error_action(on_type_error);
-        impl.set_unicode_allowed(); // determine from base
-        impl.set_underscores_allowed(allow_underscores);
-        auto convert = [impl = std::move(impl)](PyObject* x) -> PyObject* {
-            return impl.convert(x);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::INT, assess_integer_base_input(pybase));
+            impl.set_fail_action(on_fail);
+            impl.set_fail_batched(batch_on_fail);
+            impl.set_type_error_action(on_type_error);
+            impl.set_unicode_allowed(); // determine from base
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
         };
-        return choose_execution_scheme(input, convert, normalize_map(map));
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).convert(input);
+        }
+
+        return execute_conversion(input, make_impl(), normalize_map(map));
     });
 }
 
@@ -297,6 +463,7 @@ static PyObject* fastnumbers_try_forceint(
     PyObject* input = nullptr;
     PyObject* on_fail = Selectors::INPUT;
     PyObject* on_type_error = Selectors::RAISE;
+    bool batch_on_fail = false;
     bool allow_underscores = false;
     bool denoise = false;
     PyObject* map = Py_False;
@@ -307,6 +474,7 @@ static PyObject* fastnumbers_try_forceint(
     if (fn_parse_arguments("try_forceint", args, len_args, kwnames,
                            "x", false,  &input,
                            "$on_fail", false, &on_fail,
+                           "$batch_on_fail", true, &batch_on_fail,
                            "$on_type_error", false, &on_type_error,
                            "$allow_underscores", true, &allow_underscores,
                            "$map", false, &map,
@@ -317,17 +485,72 @@ static PyObject* fastnumbers_try_forceint(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        // Use a lambda instead of the convert function directly so that the
-        // Implementation object stays in memory even if we return an iterator.
-        Implementation impl(UserType::FORCEINT);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::FORCEINT);
+            impl.set_fail_action(on_fail);
+            impl.set_fail_batched(batch_on_fail);
+            impl.set_type_error_action(on_type_error);
+            impl.set_denoise(denoise);
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
+        };
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).convert(input);
+        }
+
+        return execute_conversion(input, make_impl(), normalize_map(map));
+    });
+}
+
+/**
+ * \brief Quickly convert to an int scaled by a power of ten, with error handling
+ */
+static PyObject* fastnumbers_try_scaled_int(
+    PyObject* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+) noexcept
+{
+    PyObject* input = nullptr;
+    PyObject* pyscale = nullptr;
+    PyObject* on_fail = Selectors::INPUT;
+    PyObject* on_overflow = Selectors::INPUT;
+    PyObject* on_type_error = Selectors::RAISE;
+    bool batch_on_fail = false;
+    bool allow_underscores = false;
+    PyObject* map = Py_False;
+
+    // Read the function arguments
+    FN_PREPARE_ARGPARSER;
+    // clang-format off
+    if (fn_parse_arguments("try_scaled_int", args, len_args, kwnames,
+                           "x", false,  &input,
+                           "scale", false, &pyscale,
+                           "$on_fail", false, &on_fail,
+                           "$batch_on_fail", true, &batch_on_fail,
+                           "$on_overflow", false, &on_overflow,
+                           "$on_type_error", false, &on_type_error,
+                           "$allow_underscores", true, &allow_underscores,
+                           "$map", false, &map,
+                           nullptr, false, nullptr
+        )) return nullptr;
+    // clang-format on
+
+    // Execute main logic in an exception handler to convert C++ exceptions
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        // Unlike try_array, the scale is not optional
+        if (pyscale == Py_None) {
+            PyErr_SetString(PyExc_TypeError, "scale must be an integer, not None");
+            throw exception_is_set();
+        }
+        Implementation impl(UserType::SCALED_INT);
+        impl.set_scale(assess_scale_input(pyscale));
         impl.set_fail_action(on_fail);
+        impl.set_fail_batched(batch_on_fail);
+        impl.set_overflow_action(on_overflow);
         impl.set_type_error_action(on_type_error);
-        impl.set_denoise(denoise);
         impl.set_underscores_allowed(allow_underscores);
-        auto convert = [impl = std::move(impl)](PyObject* x) -> PyObject* {
-            return impl.convert(x);
-        };
-        return choose_execution_scheme(input, convert, normalize_map(map));
+
+        return execute_conversion(input, std::move(impl), normalize_map(map));
     });
 }
 
@@ -340,12 +563,18 @@ static PyObject* fastnumbers_array(
 {
     PyObject* input = nullptr;
     PyObject* output = nullptr;
+    PyObject* dtype = nullptr;
     PyObject* inf = Selectors::ALLOWED;
     PyObject* nan = Selectors::ALLOWED;
     PyObject* on_fail = Selectors::RAISE;
     PyObject* on_overflow = Selectors::RAISE;
     PyObject* on_type_error = Selectors::RAISE;
     PyObject* pybase = nullptr;
+    PyObject* pyscale = nullptr;
+    PyObject* pyfloat_to_int = nullptr;
+    PyObject* mask = nullptr;
+    PyObject* categories = nullptr;
+    bool batch_on_fail = false;
     bool allow_underscores = false;
 
     // Read the function arguments
@@ -353,13 +582,19 @@ static PyObject* fastnumbers_array(
     // clang-format off
     if (fn_parse_arguments("array", args, len_args, kwnames,
                            "input", false,  &input,
-                           "output", false, &output,
+                           "|output", false, &output,
+                           "$dtype", false, &dtype,
                            "$inf", false, &inf,
                            "$nan", false, &nan,
                            "$on_fail", false, &on_fail,
+                           "$batch_on_fail", true, &batch_on_fail,
                            "$on_overflow", false, &on_overflow,
                            "$on_type_error", false, &on_type_error,
                            "$base", false, &pybase,
+                           "$scale", false, &pyscale,
+                           "$float_to_int", false, &pyfloat_to_int,
+                           "$mask", false, &mask,
+                           "$categories", false, &categories,
                            "$allow_underscores", true, &allow_underscores,
                            nullptr, false, nullptr
         )) return nullptr;
@@ -367,6 +602,26 @@ static PyObject* fastnumbers_array(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
+        // Without an output, create one and give it to the user
+        if (output == nullptr || output == Py_None) {
+            return array_alloc_impl(
+                input,
+                dtype,
+                inf,
+                nan,
+                on_fail,
+                on_overflow,
+                on_type_error,
+                allow_underscores,
+                assess_integer_base_input(pybase),
+                assess_scale_input(pyscale),
+                assess_float_to_int_input(pyfloat_to_int),
+                batch_on_fail,
+                mask,
+                categories
+            );
+        }
+
         array_impl(
             input,
             output,
@@ -376,7 +631,12 @@ static PyObject* fastnumbers_array(
             on_overflow,
             on_type_error,
             allow_underscores,
-            assess_integer_base_input(pybase)
+            assess_integer_base_input(pybase),
+            assess_scale_input(pyscale),
+            assess_float_to_int_input(pyfloat_to_int),
+            batch_on_fail,
+            mask,
+            categories
         );
 
         // No return value, need to return None
@@ -412,12 +672,19 @@ static PyObject* fastnumbers_check_real(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::REAL);
-        impl.set_inf_allowed(inf);
-        impl.set_nan_allowed(nan);
-        impl.set_consider(consider);
-        impl.set_underscores_allowed(allow_underscores);
-        return impl.check(input);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::REAL);
+            impl.set_inf_allowed(inf);
+            impl.set_nan_allowed(nan);
+            impl.set_consider(consider);
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
+        };
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).check(input);
+        }
+        return make_impl().check(input);
     });
 }
 
@@ -451,13 +718,20 @@ static PyObject* fastnumbers_check_float(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::FLOAT);
-        impl.set_inf_allowed(inf);
-        impl.set_nan_allowed(nan);
-        impl.set_consider(consider);
-        impl.set_strict(strict);
-        impl.set_underscores_allowed(allow_underscores);
-        return impl.check(input);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::FLOAT);
+            impl.set_inf_allowed(inf);
+            impl.set_nan_allowed(nan);
+            impl.set_consider(consider);
+            impl.set_strict(strict);
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
+        };
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).check(input);
+        }
+        return make_impl().check(input);
     });
 }
 
@@ -487,10 +761,17 @@ static PyObject* fastnumbers_check_int(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::INT, assess_integer_base_input(pybase));
-        impl.set_consider(consider);
-        impl.set_underscores_allowed(allow_underscores);
-        return impl.check(input);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::INT, assess_integer_base_input(pybase));
+            impl.set_consider(consider);
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
+        };
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).check(input);
+        }
+        return make_impl().check(input);
     });
 }
 
@@ -518,11 +799,165 @@ static PyObject* fastnumbers_check_intlike(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::INTLIKE);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::INTLIKE);
+            impl.set_consider(consider);
+            impl.set_coerce(true);
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
+        };
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).check(input);
+        }
+        return make_impl().check(input);
+    });
+}
+
+/**
+ * \brief Quickly determine if all elements of the input are ints.
+ */
+static PyObject* fastnumbers_all_int(
+    PyObject* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+) noexcept
+{
+    PyObject* input = nullptr;
+    PyObject* consider = Py_None;
+    PyObject* pybase = nullptr;
+    bool allow_underscores = false;
+
+    // Read the function arguments
+    FN_PREPARE_ARGPARSER;
+    // clang-format off
+    if (fn_parse_arguments("all_int", args, len_args, kwnames,
+                           "input", false,  &input,
+                           "$consider", false, &consider,
+                           "$base", false, &pybase,
+                           "$allow_underscores", true, &allow_underscores,
+                           nullptr, false, nullptr
+        )) return nullptr;
+    // clang-format on
+
+    // Execute main logic in an exception handler to convert C++ exceptions
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        Implementation impl(UserType::INT, assess_integer_base_input(pybase));
         impl.set_consider(consider);
-        impl.set_coerce(true);
         impl.set_underscores_allowed(allow_underscores);
-        return impl.check(input);
+        return PyBool_FromLong(first_failing_index_impl(input, impl) < 0);
+    });
+}
+
+/**
+ * \brief Quickly determine if all elements of the input are floats.
+ */
+static PyObject* fastnumbers_all_float(
+    PyObject* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+) noexcept
+{
+    PyObject* input = nullptr;
+    PyObject* consider = Py_None;
+    PyObject* inf = Selectors::NUMBER_ONLY;
+    PyObject* nan = Selectors::NUMBER_ONLY;
+    int strict = false;
+    bool allow_underscores = false;
+
+    // Read the function arguments
+    FN_PREPARE_ARGPARSER;
+    // clang-format off
+    if (fn_parse_arguments("all_float", args, len_args, kwnames,
+                           "input", false,  &input,
+                           "$inf", false, &inf,
+                           "$nan", false, &nan,
+                           "$consider", false, &consider,
+                           "$strict", true, &strict,
+                           "$allow_underscores", true, &allow_underscores,
+                           nullptr, false, nullptr
+        )) return nullptr;
+    // clang-format on
+
+    // Execute main logic in an exception handler to convert C++ exceptions
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        Implementation impl(UserType::FLOAT);
+        impl.set_inf_allowed(inf);
+        impl.set_nan_allowed(nan);
+        impl.set_consider(consider);
+        impl.set_strict(strict);
+        impl.set_underscores_allowed(allow_underscores);
+        return PyBool_FromLong(first_failing_index_impl(input, impl) < 0);
+    });
+}
+
+/**
+ * \brief Quickly determine if any element of the input is not a real.
+ */
+static PyObject* fastnumbers_any_invalid(
+    PyObject* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+) noexcept
+{
+    PyObject* input = nullptr;
+    PyObject* consider = Py_None;
+    PyObject* inf = Selectors::NUMBER_ONLY;
+    PyObject* nan = Selectors::NUMBER_ONLY;
+    bool allow_underscores = false;
+
+    // Read the function arguments
+    FN_PREPARE_ARGPARSER;
+    // clang-format off
+    if (fn_parse_arguments("any_invalid", args, len_args, kwnames,
+                           "input", false,  &input,
+                           "$inf", false, &inf,
+                           "$nan", false, &nan,
+                           "$consider", false, &consider,
+                           "$allow_underscores", true, &allow_underscores,
+                           nullptr, false, nullptr
+        )) return nullptr;
+    // clang-format on
+
+    // Execute main logic in an exception handler to convert C++ exceptions
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        Implementation impl(UserType::REAL);
+        impl.set_inf_allowed(inf);
+        impl.set_nan_allowed(nan);
+        impl.set_consider(consider);
+        impl.set_underscores_allowed(allow_underscores);
+        return PyBool_FromLong(first_failing_index_impl(input, impl) >= 0);
+    });
+}
+
+/**
+ * \brief Quickly find the first element of the input that is not a real.
+ */
+static PyObject* fastnumbers_first_invalid_index(
+    PyObject* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+) noexcept
+{
+    PyObject* input = nullptr;
+    PyObject* consider = Py_None;
+    PyObject* inf = Selectors::NUMBER_ONLY;
+    PyObject* nan = Selectors::NUMBER_ONLY;
+    bool allow_underscores = false;
+
+    // Read the function arguments
+    FN_PREPARE_ARGPARSER;
+    // clang-format off
+    if (fn_parse_arguments("first_invalid_index", args, len_args, kwnames,
+                           "input", false,  &input,
+                           "$inf", false, &inf,
+                           "$nan", false, &nan,
+                           "$consider", false, &consider,
+                           "$allow_underscores", true, &allow_underscores,
+                           nullptr, false, nullptr
+        )) return nullptr;
+    // clang-format on
+
+    // Execute main logic in an exception handler to convert C++ exceptions
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        Implementation impl(UserType::REAL);
+        impl.set_inf_allowed(inf);
+        impl.set_nan_allowed(nan);
+        impl.set_consider(consider);
+        impl.set_underscores_allowed(allow_underscores);
+        return PyLong_FromSsize_t(first_failing_index_impl(input, impl));
     });
 }
 
@@ -560,13 +995,50 @@ static PyObject* fastnumbers_query_type(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::REAL); // type doesn't matter, choose REAL
-        impl.set_inf_allowed(inf);
-        impl.set_nan_allowed(nan);
-        impl.set_coerce(coerce);
-        impl.set_allowed_types(allowed_types);
-        impl.set_underscores_allowed(allow_underscores);
-        return impl.query_type(input);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::REAL); // type doesn't matter, choose REAL
+            impl.set_inf_allowed(inf);
+            impl.set_nan_allowed(nan);
+            impl.set_coerce(coerce);
+            impl.set_allowed_types(allowed_types);
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
+        };
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).query_type(input);
+        }
+        return make_impl().query_type(input);
+    });
+}
+
+/**
+ * \brief Quickly determine the type of each element as a compact code
+ */
+static PyObject* fastnumbers_query_type_codes(
+    PyObject* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+) noexcept
+{
+    PyObject* input = nullptr;
+    PyObject* output = Py_None;
+    bool allow_underscores = false;
+
+    // Read the function arguments
+    FN_PREPARE_ARGPARSER;
+    // clang-format off
+    if (fn_parse_arguments("query_type_codes", args, len_args, kwnames,
+                           "input", false,  &input,
+                           "|output", false, &output,
+                           "$allow_underscores", true, &allow_underscores,
+                           nullptr, false, nullptr
+        )) return nullptr;
+    // clang-format on
+
+    // Execute main logic in an exception handler to convert C++ exceptions
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        return query_type_codes_impl(
+            input, output == Py_None ? nullptr : output, allow_underscores
+        );
     });
 }
 
@@ -594,10 +1066,17 @@ fastnumbers_float(PyObject* self, PyObject* const* args, Py_ssize_t len_args) no
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::FLOAT);
-        impl.set_unicode_allowed(false);
-        impl.set_underscores_allowed(true);
-        return impl.convert(input);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::FLOAT);
+            impl.set_unicode_allowed(false);
+            impl.set_underscores_allowed(true);
+            return impl;
+        };
+
+        if (only_input_given(len_args, nullptr)) {
+            return cached_default(make_impl).convert(input);
+        }
+        return make_impl().convert(input);
     });
 }
 
@@ -632,10 +1111,17 @@ static PyObject* fastnumbers_int(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::INT, assess_integer_base_input(pybase));
-        impl.set_unicode_allowed(false);
-        impl.set_underscores_allowed(true);
-        return impl.convert(input);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::INT, assess_integer_base_input(pybase));
+            impl.set_unicode_allowed(false);
+            impl.set_underscores_allowed(true);
+            return impl;
+        };
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).convert(input);
+        }
+        return make_impl().convert(input);
     });
 }
 
@@ -668,12 +1154,19 @@ static PyObject* fastnumbers_real(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::REAL);
-        impl.set_coerce(coerce);
-        impl.set_denoise(denoise);
-        impl.set_unicode_allowed(false);
-        impl.set_underscores_allowed(true);
-        return impl.convert(input);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::REAL);
+            impl.set_coerce(coerce);
+            impl.set_denoise(denoise);
+            impl.set_unicode_allowed(false);
+            impl.set_underscores_allowed(true);
+            return impl;
+        };
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).convert(input);
+        }
+        return make_impl().convert(input);
     });
 }
 
@@ -715,13 +1208,22 @@ static PyObject* fastnumbers_fast_real(
             on_fail, key, default_value, raise_on_invalid
         );
 
-        Implementation impl(UserType::REAL);
-        impl.set_fail_action(on_fail);
-        impl.set_inf_action(inf);
-        impl.set_nan_action(nan);
-        impl.set_coerce(coerce);
-        impl.set_underscores_allowed(allow_underscores);
-        return impl.convert(input);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::REAL);
+            impl.set_fail_action(on_fail);
+            impl.set_inf_action(inf);
+            impl.set_nan_action(nan);
+            impl.set_coerce(coerce);
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
+        };
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).convert(input);
+        }
+        const Implementation impl = make_impl();
+        impl.validate_not_skip();
+        return reject_skip(impl.convert(input));
     });
 }
 
@@ -761,12 +1263,21 @@ static PyObject* fastnumbers_fast_float(
             on_fail, key, default_value, raise_on_invalid
         );
 
-        Implementation impl(UserType::FLOAT);
-        impl.set_fail_action(on_fail);
-        impl.set_inf_action(inf);
-        impl.set_nan_action(nan);
-        impl.set_underscores_allowed(allow_underscores);
-        return impl.convert(input);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::FLOAT);
+            impl.set_fail_action(on_fail);
+            impl.set_inf_action(inf);
+            impl.set_nan_action(nan);
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
+        };
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).convert(input);
+        }
+        const Implementation impl = make_impl();
+        impl.validate_not_skip();
+        return reject_skip(impl.convert(input));
     });
 }
 
@@ -804,11 +1315,20 @@ static PyObject* fastnumbers_fast_int(
             on_fail, key, default_value, raise_on_invalid
         );
 
-        Implementation impl(UserType::INT, assess_integer_base_input(pybase));
-        impl.set_fail_action(on_fail);
-        impl.set_unicode_allowed(); // determine from base
-        impl.set_underscores_allowed(allow_underscores);
-        return impl.convert(input);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::INT, assess_integer_base_input(pybase));
+            impl.set_fail_action(on_fail);
+            impl.set_unicode_allowed(); // determine from base
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
+        };
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).convert(input);
+        }
+        const Implementation impl = make_impl();
+        impl.validate_not_skip();
+        return reject_skip(impl.convert(input));
     });
 }
 
@@ -844,10 +1364,19 @@ static PyObject* fastnumbers_fast_forceint(
             on_fail, key, default_value, raise_on_invalid
         );
 
-        Implementation impl(UserType::FORCEINT);
-        impl.set_fail_action(on_fail);
-        impl.set_underscores_allowed(allow_underscores);
-        return impl.convert(input);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::FORCEINT);
+            impl.set_fail_action(on_fail);
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
+        };
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).convert(input);
+        }
+        const Implementation impl = make_impl();
+        impl.validate_not_skip();
+        return reject_skip(impl.convert(input));
     });
 }
 
@@ -884,12 +1413,19 @@ static PyObject* fastnumbers_isreal(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::REAL);
-        impl.set_inf_allowed(inf);
-        impl.set_nan_allowed(nan);
-        impl.set_consider(consider);
-        impl.set_underscores_allowed(allow_underscores);
-        return impl.check(input);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::REAL);
+            impl.set_inf_allowed(inf);
+            impl.set_nan_allowed(nan);
+            impl.set_consider(consider);
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
+        };
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).check(input);
+        }
+        return make_impl().check(input);
     });
 }
 
@@ -926,12 +1462,19 @@ static PyObject* fastnumbers_isfloat(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::FLOAT);
-        impl.set_inf_allowed(inf);
-        impl.set_nan_allowed(nan);
-        impl.set_consider(consider);
-        impl.set_underscores_allowed(allow_underscores);
-        return impl.check(input);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::FLOAT);
+            impl.set_inf_allowed(inf);
+            impl.set_nan_allowed(nan);
+            impl.set_consider(consider);
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
+        };
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).check(input);
+        }
+        return make_impl().check(input);
     });
 }
 
@@ -965,10 +1508,17 @@ static PyObject* fastnumbers_isint(
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
         const int base = assess_integer_base_input(pybase);
-        Implementation impl(UserType::INT, base);
-        impl.set_consider(consider);
-        impl.set_underscores_allowed(allow_underscores);
-        return impl.check(input);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::INT, base);
+            impl.set_consider(consider);
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
+        };
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).check(input);
+        }
+        return make_impl().check(input);
     });
 }
 
@@ -999,11 +1549,18 @@ static PyObject* fastnumbers_isintlike(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::INTLIKE);
-        impl.set_consider(consider);
-        impl.set_coerce(true);
-        impl.set_underscores_allowed(allow_underscores);
-        return impl.check(input);
+        const auto make_impl = [&]() -> Implementation {
+            Implementation impl(UserType::INTLIKE);
+            impl.set_consider(consider);
+            impl.set_coerce(true);
+            impl.set_underscores_allowed(allow_underscores);
+            return impl;
+        };
+
+        if (only_input_given(len_args, kwnames)) {
+            return cached_default(make_impl).check(input);
+        }
+        return make_impl().check(input);
     });
 }
 
@@ -1025,6 +1582,10 @@ static PyMethodDef FastnumbersMethods[] = {
       (PyCFunction)fastnumbers_try_forceint,
       METH_FASTCALL | METH_KEYWORDS,
       try_forceint__doc__ },
+    { "try_scaled_int",
+      (PyCFunction)fastnumbers_try_scaled_int,
+      METH_FASTCALL | METH_KEYWORDS,
+      try_scaled_int__doc__ },
     { "array",
       (PyCFunction)fastnumbers_array,
       METH_FASTCALL | METH_KEYWORDS,
@@ -1045,10 +1606,30 @@ static PyMethodDef FastnumbersMethods[] = {
       (PyCFunction)fastnumbers_check_intlike,
       METH_FASTCALL | METH_KEYWORDS,
       check_intlike__doc__ },
+    { "all_int",
+      (PyCFunction)fastnumbers_all_int,
+      METH_FASTCALL | METH_KEYWORDS,
+      all_int__doc__ },
+    { "all_float",
+      (PyCFunction)fastnumbers_all_float,
+      METH_FASTCALL | METH_KEYWORDS,
+      all_float__doc__ },
+    { "any_invalid",
+      (PyCFunction)fastnumbers_any_invalid,
+      METH_FASTCALL | METH_KEYWORDS,
+      any_invalid__doc__ },
+    { "first_invalid_index",
+      (PyCFunction)fastnumbers_first_invalid_index,
+      METH_FASTCALL | METH_KEYWORDS,
+      first_invalid_index__doc__ },
     { "query_type",
       (PyCFunction)fastnumbers_query_type,
       METH_FASTCALL | METH_KEYWORDS,
       query_type__doc__ },
+    { "query_type_codes",
+      (PyCFunction)fastnumbers_query_type_codes,
+      METH_FASTCALL | METH_KEYWORDS,
+      query_type_codes__doc__ },
     { "int",
       (PyCFunction)fastnumbers_int,
       METH_FASTCALL | METH_KEYWORDS,
@@ -1093,17 +1674,6 @@ static PyMethodDef FastnumbersMethods[] = {
     { nullptr, nullptr, 0, nullptr } /* Sentinel */
 };
 
-// Define the module interface
-static struct PyModuleDef moduledef = { PyModuleDef_HEAD_INIT,
-                                        "fastnumbers",
-                                        fastnumbers__doc__,
-                                        -1,
-                                        FastnumbersMethods,
-                                        nullptr,
-                                        nullptr,
-                                        nullptr,
-                                        nullptr };
-
 // Initiallize static objects
 PyObject* Selectors::POS_INFINITY = nullptr;
 PyObject* Selectors::NEG_INFINITY = nullptr;
@@ -1115,13 +1685,23 @@ PyObject* Selectors::INPUT = nullptr;
 PyObject* Selectors::RAISE = nullptr;
 PyObject* Selectors::STRING_ONLY = nullptr;
 PyObject* Selectors::NUMBER_ONLY = nullptr;
+PyObject* Selectors::CLAMP = nullptr;
+PyObject* Selectors::SKIP = nullptr;
+PyObject* Selectors::PENDING = nullptr;
 
-// Actually create the module object itself
-PyMODINIT_FUNC PyInit_fastnumbers()
+/**
+ * \brief Create the selector and constant objects used internally
+ *
+ * These are created once for the process and are never modified afterwards,
+ * so they may be read from any thread without synchronization. Module
+ * execution is serialized by the import lock, so this cannot race.
+ *
+ * \return 0 on success, -1 on failure
+ */
+static int create_static_objects() noexcept
 {
-    PyObject* m = PyModule_Create(&moduledef);
-    if (m == nullptr) {
-        return nullptr;
+    if (Selectors::ALLOWED != nullptr) {
+        return 0;
     }
 
     // Selectors
@@ -1131,12 +1711,9 @@ PyMODINIT_FUNC PyInit_fastnumbers()
     Selectors::RAISE = PyObject_New(PyObject, &PyBaseObject_Type);
     Selectors::STRING_ONLY = PyObject_New(PyObject, &PyBaseObject_Type);
     Selectors::NUMBER_ONLY = PyObject_New(PyObject, &PyBaseObject_Type);
-    PyModule_AddObject(m, "ALLOWED", Selectors::ALLOWED);
-    PyModule_AddObject(m, "DISALLOWED", Selectors::DISALLOWED);
-    PyModule_AddObject(m, "INPUT", Selectors::INPUT);
-    PyModule_AddObject(m, "RAISE", Selectors::RAISE);
-    PyModule_AddObject(m, "STRING_ONLY", Selectors::STRING_ONLY);
-    PyModule_AddObject(m, "NUMBER_ONLY", Selectors::NUMBER_ONLY);
+    Selectors::CLAMP = PyObject_New(PyObject, &PyBaseObject_Type);
+    Selectors::SKIP = PyObject_New(PyObject, &PyBaseObject_Type);
+    Selectors::PENDING = PyObject_New(PyObject, &PyBaseObject_Type);
 
     // Constants cached for internal use
     PyObject* pos_inf_str = PyBytes_FromString("+infinity");
@@ -1152,5 +1729,71 @@ PyMODINIT_FUNC PyInit_fastnumbers()
     Py_DecRef(pos_nan_str);
     Py_DecRef(neg_nan_str);
 
-    return m;
+    return PyErr_Occurred() ? -1 : 0;
+}
+
+/// Add a new reference to an object to the module (the caller keeps theirs).
+static int add_object_ref(PyObject* m, const char* name, PyObject* value) noexcept
+{
+    Py_INCREF(value);
+    if (PyModule_AddObject(m, name, value) < 0) {
+        Py_DECREF(value);
+        return -1;
+    }
+    return 0;
+}
+
+// Populate the module object
+static int fastnumbers_exec(PyObject* m) noexcept
+{
+    if (PyType_Ready(&FastnumbersIteratorType) < 0) {
+        return -1;
+    }
+    if (create_static_objects() < 0 || import_array_type() < 0) {
+        return -1;
+    }
+    if (add_object_ref(m, "ALLOWED", Selectors::ALLOWED) < 0
+        || add_object_ref(m, "DISALLOWED", Selectors::DISALLOWED) < 0
+        || add_object_ref(m, "INPUT", Selectors::INPUT) < 0
+        || add_object_ref(m, "RAISE", Selectors::RAISE) < 0
+        || add_object_ref(m, "STRING_ONLY", Selectors::STRING_ONLY) < 0
+        || add_object_ref(m, "NUMBER_ONLY", Selectors::NUMBER_ONLY) < 0
+        || add_object_ref(m, "CLAMP", Selectors::CLAMP) < 0
+        || add_object_ref(m, "SKIP", Selectors::SKIP) < 0) {
+        return -1;
+    }
+    return 0;
+}
+
+// Declare how the module is to be initialized
+static PyModuleDef_Slot fastnumbers_slots[] = {
+    { Py_mod_exec, (void*)fastnumbers_exec },
+#if PY_VERSION_HEX >= 0x030C0000
+    // The selectors and cached parsers are process-wide, so they must not be
+    // shared between interpreters that each have their own object allocator
+    { Py_mod_multiple_interpreters, Py_MOD_MULTIPLE_INTERPRETERS_NOT_SUPPORTED },
+#endif
+#if PY_VERSION_HEX >= 0x030D0000
+    // All shared state is either immutable or synchronized,
+    // so the module is safe to use without the GIL
+    { Py_mod_gil, Py_MOD_GIL_NOT_USED },
+#endif
+    { 0, nullptr } /* Sentinel */
+};
+
+// Define the module interface
+static struct PyModuleDef moduledef = { PyModuleDef_HEAD_INIT,
+                                        "fastnumbers",
+                                        fastnumbers__doc__,
+                                        0,
+                                        FastnumbersMethods,
+                                        fastnumbers_slots,
+                                        nullptr,
+                                        nullptr,
+                                        nullptr };
+
+// Actually create the module object itself
+PyMODINIT_FUNC PyInit_fastnumbers()
+{
+    return PyModuleDef_Init(&moduledef);
 }
@@ -1,18 +1,29 @@
 /*
  * This file contains the high-level implementations for the Python-exposed functions
  */
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <limits>
+#include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
+#include <type_traits>
 #include <variant>
+#include <vector>
 
 #include <Python.h>
 
+#include "fastnumbers/arrow.hpp"
 #include "fastnumbers/ctype_extractor.hpp"
 #include "fastnumbers/evaluator.hpp"
 #include "fastnumbers/exception.hpp"
 #include "fastnumbers/extractor.hpp"
+#include "fastnumbers/helpers.hpp"
 #include "fastnumbers/implementation.hpp"
 #include "fastnumbers/iteration.hpp"
+#include "fastnumbers/numpy_strings.hpp"
 #include "fastnumbers/parser.hpp"
 #include "fastnumbers/payload.hpp"
 #include "fastnumbers/resolver.hpp"
@@ -21,13 +32,41 @@
 
 PyObject* Implementation::convert(PyObject* input) const noexcept(false)
 {
-    return m_resolver.resolve(input, collect_payload(input));
+    ParserDispatch dispatch;
+    return convert(input, dispatch);
+}
+
+PyObject*
+Implementation::convert(PyObject* input, ParserDispatch& dispatch) const noexcept(false)
+{
+    return m_resolver.resolve(input, collect_payload(input, dispatch));
 }
 
 PyObject* Implementation::check(PyObject* input) const noexcept(false)
+{
+    if (is_type(input)) {
+        Py_RETURN_TRUE;
+    }
+    Py_RETURN_FALSE;
+}
+
+bool Implementation::is_type(PyObject* input) const noexcept(false)
+{
+    return is_type_from_flags(collect_type(input));
+}
+
+bool Implementation::is_type(const char* str, const std::size_t len) const noexcept
+{
+    if (m_num_only) {
+        return false;
+    }
+    return is_type_from_flags(CharacterParser(str, len, m_options).get_number_type());
+}
+
+bool Implementation::is_type_from_flags(const NumberFlags& flags) const noexcept
 {
     // Assess what types we can call this input
-    auto [from_str, ok_float, ok_int, ok_intlike] = resolve_types(collect_type(input));
+    auto [from_str, ok_float, ok_int, ok_intlike] = resolve_types(flags);
 
     // For FLOAT, we are OK with integers only if not in strict mode.
     ok_int = m_ntype == UserType::FLOAT ? (from_str && !m_strict && ok_int) : ok_int;
@@ -36,17 +75,11 @@ PyObject* Implementation::check(PyObject* input) const noexcept(false)
     switch (m_ntype) {
     case UserType::REAL:
     case UserType::FLOAT:
-        if (ok_float || ok_int) {
-            Py_RETURN_TRUE;
-        }
-        break;
+        return ok_float || ok_int;
     default:
         // ok_intline is never true unless set_coerce was given as true
-        if (ok_int || ok_intlike) {
-            Py_RETURN_TRUE;
-        }
+        return ok_int || ok_intlike;
     }
-    Py_RETURN_FALSE;
 }
 
 PyObject* Implementation::query_type(PyObject* input) const noexcept(false)
@@ -71,6 +104,48 @@ PyObject* Implementation::query_type(PyObject* input) const noexcept(false)
     return found_type;
 }
 
+/**
+ * \brief Classify the result of a parser as a compact code
+ *
+ * The parser type is needed in addition to the number flags in order to
+ * distinguish text that is not a number from input that is not text at all.
+ */
+template <typename Parser>
+static TypeCode type_code_from_parser(const Parser& parser) noexcept
+{
+    const NumberFlags flags = parser.get_number_type();
+    if (flags & NumberType::INVALID) {
+        return parser.parser_type() == ParserType::NUMERIC ? TypeCode::OTHER
+                                                           : TypeCode::INVALID;
+    } else if (flags & NumberType::Infinity) {
+        return TypeCode::INF;
+    } else if (flags & NumberType::NaN) {
+        return TypeCode::NAN_;
+    } else if (flags & NumberType::Integer) {
+        return TypeCode::INT;
+    } else if (flags & NumberType::IntLike) {
+        return TypeCode::INTLIKE;
+    }
+    return TypeCode::FLOAT;
+}
+
+TypeCode Implementation::query_type_code(PyObject* input) const noexcept(false)
+{
+    Buffer buffer;
+    return std::visit(
+        [](const auto& parser) -> TypeCode {
+            return type_code_from_parser(parser);
+        },
+        extract_parser(input, buffer, m_options)
+    );
+}
+
+TypeCode
+Implementation::query_type_code(const char* str, const std::size_t len) const noexcept
+{
+    return type_code_from_parser(CharacterParser(str, len, m_options));
+}
+
 void Implementation::set_consider(const PyObject* val) noexcept(false)
 {
     const bool ok = val == Py_None || val == Selectors::NUMBER_ONLY
@@ -101,20 +176,16 @@ void Implementation::set_allowed_types(PyObject* val) noexcept(false)
     m_allowed_types = Selectors::incref(val);
 }
 
-Payload Implementation::collect_payload(PyObject* obj) const noexcept(false)
+Payload Implementation::collect_payload(
+    PyObject* obj, ParserDispatch& dispatch
+) const noexcept(false)
 {
-    Buffer buffer;
-
-    // extract_parser() is responsible for taking a python object
-    // and returning the Parser object best suited to parser the object's data.
-    // std:visit is used to obtain the payload data no matter which parser was
-    // returned.
-    return std::visit(
-        [this, obj](const auto& parser) -> Payload {
-            return Evaluator<decltype(parser)>(obj, m_options, parser).as_type(m_ntype);
-        },
-        extract_parser(obj, buffer, m_options)
-    );
+    // The dispatch is responsible for choosing the Parser object best suited
+    // to parse the object's data, and gives it to the function no matter
+    // which parser it is.
+    return dispatch(obj, m_options, [this, obj](const auto& parser) -> Payload {
+        return Evaluator<decltype(parser)>(obj, m_options, parser).as_type(m_ntype);
+    });
 }
 
 NumberFlags Implementation::collect_type(PyObject* obj) const noexcept(false)
@@ -181,12 +252,13 @@ void Implementation::validate_not_allow_disallow_str_only_num_only(
 ) const noexcept(false)
 {
     const bool bad = selector == Selectors::ALLOWED || selector == Selectors::DISALLOWED
-        || selector == Selectors::NUMBER_ONLY || selector == Selectors::STRING_ONLY;
+        || selector == Selectors::NUMBER_ONLY || selector == Selectors::STRING_ONLY
+        || selector == Selectors::CLAMP;
     if (bad) {
         throw fastnumbers_exception(
             "values for 'on_fail' and 'on_type_error' cannot be fastnumbers.ALLOWED, "
-            "fastnumbers.DISALLOWED, fastnumbers.NUMBER_ONLY, or "
-            "fastnumbers.STRING_ONLY"
+            "fastnumbers.DISALLOWED, fastnumbers.NUMBER_ONLY, "
+            "fastnumbers.STRING_ONLY, or fastnumbers.CLAMP"
         );
     }
 }
@@ -196,11 +268,12 @@ void Implementation::validate_not_disallow(const PyObject* selector) const noexc
 )
 {
     const bool bad = selector == Selectors::DISALLOWED
-        || selector == Selectors::STRING_ONLY || selector == Selectors::NUMBER_ONLY;
+        || selector == Selectors::STRING_ONLY || selector == Selectors::NUMBER_ONLY
+        || selector == Selectors::CLAMP;
     if (bad) {
         throw fastnumbers_exception(
             "'inf' and 'nan' cannot be fastnumbers.DISALLOWED, "
-            "fastnumbers.STRING_ONLY, or fastnumbers.NUMBER_ONLY"
+            "fastnumbers.STRING_ONLY, fastnumbers.NUMBER_ONLY, or fastnumbers.CLAMP"
         );
     }
 }
@@ -225,6 +298,112 @@ PyObject* list_iteration_impl(
     return list_builder.get();
 }
 
+/**
+ * \brief Replace placeholders in a list with the results of a batched callable
+ * \param list_builder The list containing the placeholders
+ * \param callable The batched callable for conversion failure
+ * \param failed The list of inputs that failed, which is replaced afterwards
+ * \param indices The location in the list of the placeholder for each input
+ */
+static void resolve_failed_batch(
+    ListBuilder& list_builder,
+    PyObject* callable,
+    PyObject*& failed,
+    std::vector<Py_ssize_t>& indices
+) noexcept(false)
+{
+    if (indices.empty()) {
+        return;
+    }
+    PyObject* replacements = call_batched_callable(callable, failed);
+    if (replacements == nullptr) {
+        throw exception_is_set();
+    }
+    PyObject** items = PySequence_Fast_ITEMS(replacements);
+    bool skipped = false;
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+        Py_INCREF(items[i]);
+        list_builder.replace(indices[i], items[i]);
+        skipped = skipped || items[i] == Selectors::SKIP;
+    }
+    Py_DECREF(replacements);
+
+    // A SKIP from the callable leaves its element out, as it would for
+    // a callable that is given one input at a time
+    if (skipped) {
+        list_builder.remove_skipped(indices.front());
+    }
+    indices.clear();
+
+    // The callable may have kept the list, so do not reuse it
+    Py_DECREF(failed);
+    if ((failed = PyList_New(0)) == nullptr) {
+        throw exception_is_set();
+    }
+}
+
+// Implementation for iterating over a collection to populate a list,
+// converting failures in batches
+PyObject*
+list_batched_iteration_impl(PyObject* input, const Implementation& impl) noexcept(false)
+{
+    PyObject* on_fail = impl.batched_fail_callable();
+    const Implementation deferred = impl.with_deferred_fail();
+
+    // Create a python list into which to store the return values
+    ListBuilder list_builder(input);
+
+    // The inputs that failed since the last batch, and where they belong
+    PyObject* failed = PyList_New(0);
+    if (failed == nullptr) {
+        throw exception_is_set();
+    }
+    std::vector<Py_ssize_t> indices;
+    indices.reserve(FAIL_BATCH_SIZE);
+
+    try {
+        // A failure is left as a placeholder, remembering the input for later
+        ParserDispatch dispatch;
+        IterableManager<PyObject*> iter_manager(input, [&](PyObject* x) -> PyObject* {
+            PyObject* value = deferred.convert(x, dispatch);
+            if (value == Selectors::PENDING && PyList_Append(failed, x) != 0) {
+                Py_DECREF(value);
+                throw exception_is_set();
+            }
+            return value;
+        });
+
+        for (auto& value : iter_manager) {
+            const bool pending = value == Selectors::PENDING;
+            if (pending) {
+                indices.push_back(list_builder.size());
+            }
+            list_builder.append(value);
+            if (pending && indices.size() == FAIL_BATCH_SIZE) {
+                resolve_failed_batch(list_builder, on_fail, failed, indices);
+            }
+        }
+        resolve_failed_batch(list_builder, on_fail, failed, indices);
+    } catch (...) {
+        Py_XDECREF(failed);
+        throw;
+    }
+    Py_DECREF(failed);
+
+    // Return the list to the user
+    return list_builder.get();
+}
+
+// Per-object locking only exists (and is only needed) on newer Pythons.
+// With the GIL these expand to a plain scope.
+#if PY_VERSION_HEX >= 0x030D0000
+#define FN_BEGIN_CRITICAL_SECTION(op) Py_BEGIN_CRITICAL_SECTION(op)
+#define FN_END_CRITICAL_SECTION() Py_END_CRITICAL_SECTION()
+#else
+#define FN_BEGIN_CRITICAL_SECTION(op) {
+#define FN_END_CRITICAL_SECTION() }
+#endif
+
 /**
  * \struct FastnumbersIterator
  * \brief Object containing the state of the fastnumbers iterator
@@ -271,9 +450,14 @@ struct FastnumbersIterator {
         assert(it != nullptr);
         assert(it->it_man != nullptr);
 
+        // Iterator state is not atomic - on free-threaded builds make sure only
+        // one thread at a time advances a given iterator.
+        PyObject* result = nullptr;
+        FN_BEGIN_CRITICAL_SECTION(it);
+
         // Run inside an exception handler to ensure anything we throw gets converted
         // into a Python exception.
-        return ExceptionHandler(it->it_input).run([&it]() -> PyObject* {
+        result = ExceptionHandler(it->it_input).run([&it]() -> PyObject* {
             // On the first iteration, prime the iterator.
             // On subsequent iterations, just increment it.
             if (it->it_first) {
@@ -283,6 +467,12 @@ struct FastnumbersIterator {
                 ++it->it_iter;
             }
 
+            // Elements that should be skipped are never returned
+            while (it->it_iter != it->it_man->end() && *it->it_iter == Selectors::SKIP) {
+                Py_DECREF(*it->it_iter);
+                ++it->it_iter;
+            }
+
             // If the C++ iterator is exhausted, return NULL to
             // tell Python the iterator is exhausted
             if (it->it_iter == it->it_man->end()) {
@@ -292,6 +482,9 @@ struct FastnumbersIterator {
             // Return the current value held in the itertor
             return *it->it_iter;
         });
+
+        FN_END_CRITICAL_SECTION();
+        return result;
     }
 };
 
@@ -366,175 +559,1509 @@ PyObject* iter_iteration_impl(
     return (PyObject*)it;
 }
 
+/// The maximum number of ASCII strings checked per release of the GIL
+constexpr Py_ssize_t ASCII_BATCH_SIZE = 256;
+
 /**
- * \struct ArrayImpl
- * \brief Executor of array population, manages Python memory buffer
+ * \brief Return a new reference to an element of a list or tuple
+ *
+ * Without the GIL another thread may replace or remove a list element at
+ * any moment, so there the reference is taken atomically with the element.
+ *
+ * \return The element, or NULL if the index is past the current end
  */
-struct ArrayImpl {
-    /// The input object as given by Python
-    PyObject* m_input;
-
-    /// The output object, represented as a memory view buffer
-    Py_buffer& m_output;
-
-    /// The action to take if INF is found
-    PyObject* m_inf;
-
-    /// The action to take if NaN is found
-    PyObject* m_nan;
-
-    /// The action to take if input is invalid
-    PyObject* m_on_fail;
-
-    /// The action to take if input overflows
-    PyObject* m_on_overflow;
-
-    /// The action to take if input is of incorrect type
-    PyObject* m_on_type_error;
-
-    /// Whether or not to allow underscores in strings
-    bool m_allow_underscores;
-
-    /// The base to use when parsing integers
-    int m_base;
-
-    /// Release the Python memoryview buffer
-    ~ArrayImpl() noexcept { PyBuffer_Release(&m_output); }
-
-    /// Perform the actual array population logic
-    template <typename T>
-    void execute() noexcept(false)
-    {
-        UserOptions options;
-        options.set_base(m_base);
-        options.set_underscores_allowed(m_allow_underscores);
+static inline PyObject* sequence_item_ref(PyObject* seq, Py_ssize_t index) noexcept
+{
+#ifdef Py_GIL_DISABLED
+    if (PyList_Check(seq)) {
+        PyObject* item = PyList_GetItemRef(seq, index);
+        if (item == nullptr) {
+            PyErr_Clear(); // IndexError
+        }
+        return item;
+    }
+#endif
+    if (index >= PySequence_Fast_GET_SIZE(seq)) {
+        return nullptr;
+    }
+    PyObject* item = PySequence_Fast_GET_ITEM(seq, index);
+    Py_INCREF(item);
+    return item;
+}
 
-        // Define how a Python object can be converted into a C number type
-        CTypeExtractor<T> extractor(options);
-        extractor.set_inf_replacement(m_inf);
-        extractor.set_nan_replacement(m_nan);
-        extractor.set_fail_replacement(m_on_fail);
-        extractor.set_overflow_replacement(m_on_overflow);
-        extractor.set_type_error_replacement(m_on_type_error);
+/**
+ * \brief Find the first element of a list or tuple that fails the type check
+ *
+ * Consecutive exact ASCII str elements are gathered into a batch
+ * (holding a reference to each so they stay alive) and then checked with
+ * the GIL released. Anything else is checked one at a time with the GIL held.
+ */
+static Py_ssize_t
+first_failing_index_in_sequence(PyObject* seq, const Implementation& impl) noexcept(
+    false
+)
+{
+    PyObject* batch[ASCII_BATCH_SIZE];
+    Py_ssize_t index = 0;
+
+    // The size is re-checked for each element because the check might
+    // execute Python code (or, without the GIL, other threads may run)
+    while (true) {
+        Py_ssize_t n_batch = 0;
+        PyObject* item = nullptr;
+        while (n_batch < ASCII_BATCH_SIZE
+               && (item = sequence_item_ref(seq, index + n_batch)) != nullptr) {
+            if (!PyUnicode_CheckExact(item) || !PyUnicode_IS_COMPACT_ASCII(item)) {
+                break;
+            }
+            batch[n_batch++] = item;
+            item = nullptr;
+        }
 
-        // Define how we convert each element of the iterable
-        IterableManager<T> iter_man(m_input, [&extractor](PyObject* x) -> T {
-            return extractor.extract_c_number(x);
-        });
+        // Not an ASCII string, so go through the general code path
+        if (n_batch == 0) {
+            if (item == nullptr) {
+                return -1;
+            }
+            bool ok = false;
+            try {
+                ok = impl.is_type(item);
+            } catch (...) {
+                Py_DECREF(item);
+                throw;
+            }
+            Py_DECREF(item);
+            if (!ok) {
+                return index;
+            }
+            index += 1;
+            continue;
+        }
 
-        // Create a handler for inserting data into the output memory buffer
-        ArrayPopulator pop(m_output, iter_man.get_size());
+        // The element that ended the batch is fetched again afterwards
+        Py_XDECREF(item);
+
+        // Check the batch of ASCII data without the GIL
+        Py_ssize_t failed = -1;
+        Py_BEGIN_ALLOW_THREADS
+        for (Py_ssize_t i = 0; i < n_batch; ++i) {
+            const char* str = (const char*)PyUnicode_1BYTE_DATA(batch[i]);
+            const auto len = static_cast<std::size_t>(PyUnicode_GET_LENGTH(batch[i]));
+            if (!impl.is_type(str, len)) {
+                failed = i;
+                break;
+            }
+        }
+        Py_END_ALLOW_THREADS
 
-        // Iterate over the input data, convert it, and place it in the output
-        for (const auto& value : iter_man) {
-            pop.place_next(value);
+        for (Py_ssize_t i = 0; i < n_batch; ++i) {
+            Py_DECREF(batch[i]);
         }
+        if (failed >= 0) {
+            return index + failed;
+        }
+        index += n_batch;
     }
-};
+}
+
+/// The number of StringDType cells read per acquisition of numpy's allocator
+constexpr Py_ssize_t TEXT_CHUNK_SIZE = 256;
+
+/// Whether or not all the given characters are ASCII
+static inline bool is_ascii_text(const std::string_view text) noexcept
+{
+    return std::all_of(text.cbegin(), text.cend(), [](const char c) {
+        return (static_cast<unsigned char>(c) & 0x80U) == 0;
+    });
+}
 
 /**
- * \brief Validate the selector is not a "yes, no, num, str, input" value
- * \param selector The python object to validate
- * \throws fastnumbers_exception if one of the four valid values
+ * \brief Create the Python object for a cell of an Arrow or StringDType array
+ * \param text The UTF-8 text of the cell, or std::nullopt if it is missing
+ * \return A new reference to a str, or to None for a missing cell
  */
-static inline void validate_not_allow_disallow_str_only_num_only_input(
-    const PyObject* selector
+static PyObject* text_cell_object(const std::optional<std::string_view>& text
 ) noexcept(false)
 {
-    const bool bad = selector == Selectors::ALLOWED || selector == Selectors::DISALLOWED
-        || selector == Selectors::NUMBER_ONLY || selector == Selectors::STRING_ONLY
-        || selector == Selectors::INPUT;
-    if (bad) {
-        throw fastnumbers_exception(
-            "values for 'on_fail', 'on_overflow', and 'on_type_error' cannot be "
-            "fastnumbers.ALLOWED, fastnumbers.DISALLOWED, fastnumbers.NUMBER_ONLY, "
-            "fastnumbers.STRING_ONLY, or fastnumbers.INPUT"
-        );
+    if (!text) {
+        Py_RETURN_NONE;
+    }
+    PyObject* str = PyUnicode_DecodeUTF8(
+        text->data(), static_cast<Py_ssize_t>(text->size()), "strict"
+    );
+    if (str == nullptr) {
+        throw exception_is_set();
     }
+    return str;
 }
 
 /**
- * \brief Validate the selector is not a "no, num, str, input" value
- * \param selector The python object to validate
- * \throws fastnumbers_exception if one of the four valid values
+ * \brief Process each cell of an Arrow or StringDType array in order
+ *
+ * The text of each cell is first given to in_place, which may decline it.
+ * StringDType cells are read in chunks while holding numpy's allocator, so
+ * in_place must not call into Python. Declined and missing cells are
+ * instead given to with_python once the allocator has been released.
+ *
+ * \param arrow The Arrow array to read, or nullptr to read numpy_strings
+ * \param numpy_strings The StringDType array to read
+ * \param in_place Callable accepting a std::string_view and returning a
+ *                 std::optional<Result>, std::nullopt to decline the cell
+ * \param with_python Callable accepting the text of a cell (std::nullopt
+ *                    if missing) and returning a Result
+ * \param store Callable accepting the Result of each cell in order,
+ *              returning false to stop
  */
-static inline void
-validate_not_disallow_str_only_num_only_input(const PyObject* selector) noexcept(false)
+template <typename Result, typename InPlace, typename WithPython, typename Store>
+static void process_text_cells(
+    const ArrowStringArray* arrow,
+    NumpyStringArray* numpy_strings,
+    InPlace in_place,
+    WithPython with_python,
+    Store store
+) noexcept(false)
 {
-    const bool bad = selector == Selectors::DISALLOWED
-        || selector == Selectors::NUMBER_ONLY || selector == Selectors::STRING_ONLY
-        || selector == Selectors::INPUT || selector == Selectors::RAISE;
-    if (bad) {
-        throw fastnumbers_exception(
-            "values for 'inf' and 'nan' cannot be fastnumbers.DISALLOWED, "
-            "fastnumbers.NUMBER_ONLY, fastnumbers.STRING_ONLY, fastnumbers.INPUT "
-            "or fastnumbers.RAISE"
+    if (arrow != nullptr) {
+        for (Py_ssize_t i = 0; i < arrow->size(); ++i) {
+            std::optional<std::string_view> text;
+            std::optional<Result> result;
+            if (!arrow->is_null(i)) {
+                text = arrow->text(i);
+                result = in_place(*text);
+            }
+            if (!store(result ? *result : with_python(text))) {
+                return;
+            }
+        }
+        return;
+    }
+
+    // The results of one chunk, and a copy of the text of each declined cell
+    struct Declined {
+        std::size_t offset;
+        std::size_t size;
+        bool missing;
+    };
+    std::vector<std::optional<Result>> results;
+    std::vector<Declined> declined;
+    std::string copies;
+
+    const Py_ssize_t n_cells = numpy_strings->size();
+    for (Py_ssize_t begin = 0; begin < n_cells; begin += TEXT_CHUNK_SIZE) {
+        results.clear();
+        declined.clear();
+        copies.clear();
+        numpy_strings->read(
+            begin,
+            std::min(begin + TEXT_CHUNK_SIZE, n_cells),
+            [&](Py_ssize_t, const std::optional<std::string_view>& text) {
+                results.push_back(text ? in_place(*text) : std::nullopt);
+                if (!results.back()) {
+                    const std::size_t size = text ? text->size() : 0;
+                    declined.push_back({ copies.size(), size, !text });
+                    copies.append(text ? *text : std::string_view());
+                }
+            }
         );
+
+        // Now that the allocator is released the declined cells may use Python
+        auto next = declined.cbegin();
+        for (const auto& result : results) {
+            if (result) {
+                if (!store(*result)) {
+                    return;
+                }
+                continue;
+            }
+            std::optional<std::string_view> text;
+            if (!next->missing) {
+                text = std::string_view(copies).substr(next->offset, next->size);
+            }
+            ++next;
+            if (!store(with_python(text))) {
+                return;
+            }
+        }
     }
 }
 
-// Implementation for iterating over a collection to populate an array
-void array_impl(
-    PyObject* input,
-    PyObject* output,
-    PyObject* inf,
-    PyObject* nan,
-    PyObject* on_fail,
-    PyObject* on_overflow,
-    PyObject* on_type_error,
-    bool allow_underscores,
-    int base
-) noexcept(false)
+// Implementation for finding the first element of a collection that fails a check
+Py_ssize_t
+first_failing_index_impl(PyObject* input, const Implementation& impl) noexcept(false)
 {
-    // Ensure the given parameters are valid.
-    validate_not_disallow_str_only_num_only_input(inf);
-    validate_not_disallow_str_only_num_only_input(nan);
-    validate_not_allow_disallow_str_only_num_only_input(on_fail);
-    validate_not_allow_disallow_str_only_num_only_input(on_overflow);
-    validate_not_allow_disallow_str_only_num_only_input(on_type_error);
+    if (PyList_Check(input) || PyTuple_Check(input)) {
+        return first_failing_index_in_sequence(input, impl);
+    }
 
-    // Extract the underlying buffer data from the output object
-    Py_buffer buf { nullptr, nullptr };
-    constexpr auto flags = PyBUF_WRITABLE | PyBUF_STRIDES | PyBUF_FORMAT;
-    if (PyObject_GetBuffer(output, &buf, flags) != 0) {
-        // This should be impossible to encounter because of guards in the python code
-        throw exception_is_set();
+    // The cells of an Arrow or StringDType array are checked straight from
+    // their storage, creating a str only for those that are not ASCII
+    const ArrowStringArray arrow(input);
+    NumpyStringArray numpy_strings(input);
+    if (arrow || numpy_strings) {
+        Py_ssize_t index = 0;
+        bool failed = false;
+        process_text_cells<bool>(
+            arrow ? &arrow : nullptr,
+            &numpy_strings,
+            [&impl](const std::string_view text) -> std::optional<bool> {
+                if (!is_ascii_text(text)) {
+                    return std::nullopt;
+                }
+                return impl.is_type(text.data(), text.size());
+            },
+            [&impl](const std::optional<std::string_view>& text) -> bool {
+                PyObject* cell = text_cell_object(text);
+                bool ok = false;
+                try {
+                    ok = impl.is_type(cell);
+                } catch (...) {
+                    Py_DECREF(cell);
+                    throw;
+                }
+                Py_DECREF(cell);
+                return ok;
+            },
+            [&](const bool ok) {
+                failed = !ok;
+                index += ok ? 1 : 0;
+                return ok;
+            }
+        );
+        return failed ? index : -1;
     }
 
-    // Pass on all arguments to the actual implementation
-    // NOTE: This will manage the buffer object for us
-    ArrayImpl impl {
-        input, buf, inf, nan, on_fail, on_overflow, on_type_error, allow_underscores,
-        base,
-    };
+    // The helper for iterating over the Python iterable
+    IterableManager<bool> iter_man(input, [&impl](PyObject* x) -> bool {
+        return impl.is_type(x);
+    });
+
+    // Stop at the first element that fails the check
+    Py_ssize_t index = 0;
+    for (const auto& ok : iter_man) {
+        if (!ok) {
+            return index;
+        }
+        index += 1;
+    }
+    return -1;
+}
 
-    // Use the format to determine the code path to execute
+/**
+ * \brief Call a function with a value of the C type matching a buffer format
+ *
+ * \param format The buffer format string
+ * \param function A generic callable, whose argument type is the C type
+ * \return false if the format is not a supported numeric type
+ */
+template <typename Function>
+static bool dispatch_on_format(const std::string_view format, Function function)
+{
     // Attempt to order this if-branch by anticipated frequency of use
-    const std::string_view format(buf.format == nullptr ? "<NULL>" : buf.format);
     if (format == "d") {
-        return impl.execute<double>();
+        function(double());
     } else if (format == "l") {
-        return impl.execute<signed long>();
+        function((signed long)0);
     } else if (format == "q") {
-        return impl.execute<signed long long>();
+        function((signed long long)0);
     } else if (format == "i") {
-        return impl.execute<signed int>();
+        function((signed int)0);
     } else if (format == "f") {
-        return impl.execute<float>();
+        function(float());
     } else if (format == "L") {
-        return impl.execute<unsigned long>();
+        function((unsigned long)0);
     } else if (format == "Q") {
-        return impl.execute<unsigned long long>();
+        function((unsigned long long)0);
     } else if (format == "I") {
-        return impl.execute<unsigned int>();
+        function((unsigned int)0);
     } else if (format == "h") {
-        return impl.execute<signed short>();
+        function((signed short)0);
     } else if (format == "b") {
-        return impl.execute<signed char>();
+        function((signed char)0);
     } else if (format == "H") {
-        return impl.execute<unsigned short>();
+        function((unsigned short)0);
     } else if (format == "B") {
-        return impl.execute<unsigned char>();
+        function((unsigned char)0);
+    } else if (format == "e") {
+        function(Half());
+    } else if (format == "?") {
+        function(bool());
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * \brief Place type codes into an output buffer and summarize them
+ *
+ * \param output The object in which to place the codes, or NULL for a bytearray
+ * \param length The number of codes, or -1 if not known in advance
+ * \param classify Callable accepting a callable to which each code is given
+ * \return A tuple of the output and the count of each code
+ */
+template <typename Classify>
+static PyObject* populate_type_codes(
+    PyObject* output, const Py_ssize_t length, Classify classify
+) noexcept(false)
+{
+    // If no output was given, create a bytearray to store the codes
+    if (output == nullptr) {
+        output = PyByteArray_FromStringAndSize(nullptr, length);
+        if (output == nullptr) {
+            throw exception_is_set();
+        }
+    } else {
+        Py_INCREF(output);
+    }
+
+    // Extract the underlying buffer data from the output object
+    Py_buffer buf { nullptr, nullptr };
+    constexpr auto flags = PyBUF_WRITABLE | PyBUF_STRIDES | PyBUF_FORMAT;
+    if (PyObject_GetBuffer(output, &buf, flags) != 0) {
+        Py_DECREF(output);
+        throw exception_is_set();
+    }
+    const std::string_view format(buf.format == nullptr ? "B" : buf.format);
+    if (format != "B") {
+        PyErr_Format(
+            PyExc_TypeError,
+            "Buffer format for type codes must be 'B' (uint8), not '%s' for object "
+            "'%.200R'",
+            buf.format,
+            output
+        );
+        PyBuffer_Release(&buf);
+        Py_DECREF(output);
+        throw exception_is_set();
+    }
+
+    // Classify each element, placing the code in the output and counting it
+    Py_ssize_t counts[N_TYPE_CODES] = { 0 };
+    try {
+        ArrayPopulator pop(buf, length);
+        classify([&](const TypeCode code) {
+            pop.place_next(static_cast<uint8_t>(code));
+            counts[static_cast<std::size_t>(code)] += 1;
+        });
+    } catch (...) {
+        PyBuffer_Release(&buf);
+        Py_DECREF(output);
+        throw;
+    }
+    PyBuffer_Release(&buf);
+
+    // Summarize the counts as a tuple indexed by the code
+    PyObject* histogram = PyTuple_New(N_TYPE_CODES);
+    if (histogram == nullptr) {
+        Py_DECREF(output);
+        throw exception_is_set();
+    }
+    for (std::size_t i = 0; i < N_TYPE_CODES; ++i) {
+        PyObject* count = PyLong_FromSsize_t(counts[i]);
+        if (count == nullptr) {
+            Py_DECREF(histogram);
+            Py_DECREF(output);
+            throw exception_is_set();
+        }
+        PyTuple_SET_ITEM(histogram, static_cast<Py_ssize_t>(i), count);
+    }
+
+    // Return both to the user, the tuple holds its own references
+    PyObject* result = PyTuple_Pack(2, output, histogram);
+    Py_DECREF(output);
+    Py_DECREF(histogram);
+    if (result == nullptr) {
+        throw exception_is_set();
+    }
+    return result;
+}
+
+// Implementation for iterating over a collection to populate an array of type codes
+PyObject* query_type_codes_impl(
+    PyObject* input, PyObject* output, bool allow_underscores
+) noexcept(false)
+{
+    Implementation impl(UserType::REAL); // type doesn't matter, choose REAL
+    impl.set_underscores_allowed(allow_underscores);
+
+    // The cells of an Arrow or StringDType array are classified straight from
+    // their storage, creating a str only for those that are not ASCII
+    const ArrowStringArray arrow(input);
+    NumpyStringArray numpy_strings(input);
+    if (arrow || numpy_strings) {
+        const Py_ssize_t length = arrow ? arrow.size() : numpy_strings.size();
+        return populate_type_codes(output, length, [&](auto place) {
+            process_text_cells<TypeCode>(
+                arrow ? &arrow : nullptr,
+                &numpy_strings,
+                [&impl](const std::string_view text) -> std::optional<TypeCode> {
+                    if (!is_ascii_text(text)) {
+                        return std::nullopt;
+                    }
+                    return impl.query_type_code(text.data(), text.size());
+                },
+                [&impl](const std::optional<std::string_view>& text) -> TypeCode {
+                    PyObject* cell = text_cell_object(text);
+                    TypeCode code = TypeCode::OTHER;
+                    try {
+                        code = impl.query_type_code(cell);
+                    } catch (...) {
+                        Py_DECREF(cell);
+                        throw;
+                    }
+                    Py_DECREF(cell);
+                    return code;
+                },
+                [&place](const TypeCode code) {
+                    place(code);
+                    return true;
+                }
+            );
+        });
+    }
+
+    // Define how we classify each element of the iterable
+    IterableManager<TypeCode> iter_man(input, [&impl](PyObject* x) -> TypeCode {
+        return impl.query_type_code(x);
+    });
+    return populate_type_codes(output, iter_man.get_size(), [&](auto place) {
+        for (const auto& code : iter_man) {
+            place(code);
+        }
+    });
+}
+
+/**
+ * \class CategoryCache
+ * \brief The converted values of the categories of dictionary-encoded input
+ *
+ * Each category is converted the first time its code is seen and then
+ * reused, so every distinct string is parsed at most once. Categories
+ * that are never referenced are never converted, and so cannot raise.
+ * The code -1 marks a missing element, which is converted as None would be.
+ */
+template <typename T>
+class CategoryCache {
+public:
+    /// The converted value of one category
+    struct Entry {
+        /// The value to place in the output
+        T value;
+
+        /// Whether or not the conversion was flagged (e.g. failed or was NaN)
+        bool flagged;
+
+        /// Whether or not the category has been converted yet
+        bool converted;
+    };
+
+    /**
+     * \brief Prepare the categories for conversion
+     * \param categories An Arrow string array or a sequence of the categories
+     * \throw exception_is_set If the categories are not a sequence
+     */
+    explicit CategoryCache(PyObject* categories) noexcept(false)
+        : m_arrow(categories)
+        , m_sequence(nullptr)
+        , m_size(0)
+        , m_entries()
+    {
+        if (m_arrow) {
+            m_size = m_arrow.size();
+        } else {
+            if (PyUnicode_Check(categories) || PyBytes_Check(categories)) {
+                PyErr_Format(
+                    PyExc_TypeError,
+                    "categories must be a sequence of strings, not '%s'",
+                    Py_TYPE(categories)->tp_name
+                );
+                throw exception_is_set();
+            }
+            m_sequence = PySequence_Fast(categories, "categories must be a sequence");
+            if (m_sequence == nullptr) {
+                throw exception_is_set();
+            }
+            m_size = PySequence_Fast_GET_SIZE(m_sequence);
+        }
+        // The last entry holds the conversion of a missing element
+        const std::size_t n_entries = static_cast<std::size_t>(m_size) + 1;
+        m_entries.resize(n_entries, Entry { T(), false, false });
+    }
+
+    // Copy and assignment are disallowed
+    CategoryCache(const CategoryCache&) = delete;
+    CategoryCache(CategoryCache&&) = delete;
+    CategoryCache& operator=(const CategoryCache&) = delete;
+
+    /// Release the sequence of categories
+    ~CategoryCache() noexcept { Py_XDECREF(m_sequence); }
+
+    /// The number of categories
+    Py_ssize_t size() const noexcept { return m_size; }
+
+    /**
+     * \brief Return the converted category for the given code
+     *
+     * A failure deferred to a batched callable is resolved right away,
+     * since the value is shared by every element with the same code.
+     *
+     * \param extractor Converter of a category into a C number
+     * \param code The code of the category, or -1 if missing
+     * \throw exception_is_set If the code is out of range or conversion fails
+     */
+    const Entry& lookup(CTypeExtractor<T>& extractor, const Py_ssize_t code) noexcept(
+        false
+    )
+    {
+        if (code < -1 || code >= m_size) {
+            PyErr_Format(
+                PyExc_ValueError,
+                "category code %zd is out of range for %zd categories",
+                code,
+                m_size
+            );
+            throw exception_is_set();
+        }
+        Entry& entry = m_entries[static_cast<std::size_t>(code == -1 ? m_size : code)];
+        if (!entry.converted) {
+            entry.value = convert(extractor, code);
+            entry.flagged = extractor.flagged();
+            if (extractor.deferred()) {
+                extractor.defer_to(&entry.value);
+                extractor.resolve_deferred();
+            }
+            entry.converted = true;
+        }
+        return entry;
+    }
+
+private:
+    /// Convert the category with the given code
+    T convert(CTypeExtractor<T>& extractor, const Py_ssize_t code) const
+        noexcept(false)
+    {
+        if (code == -1) {
+            return extractor.extract_c_number(Py_None);
+        }
+        if (m_sequence != nullptr) {
+            PyObject* category = sequence_item_ref(m_sequence, code);
+            if (category == nullptr) {
+                PyErr_SetString(
+                    PyExc_RuntimeError, "categories changed size during conversion"
+                );
+                throw exception_is_set();
+            }
+            try {
+                const T value = extractor.extract_c_number(category);
+                Py_DECREF(category);
+                return value;
+            } catch (...) {
+                Py_DECREF(category);
+                throw;
+            }
+        }
+        if (m_arrow.is_null(code)) {
+            return extractor.extract_c_number(Py_None);
+        }
+        const std::string_view text = m_arrow.text(code);
+        return extractor.extract_c_number(text.data(), text.size());
+    }
+
+    /// The categories as an Arrow string array (empty if they are not one)
+    ArrowStringArray m_arrow;
+
+    /// The categories as a list or tuple (nullptr if Arrow)
+    PyObject* m_sequence;
+
+    /// The number of categories
+    Py_ssize_t m_size;
+
+    /// The converted categories, followed by the missing element
+    std::vector<Entry> m_entries;
+};
+
+/**
+ * \brief Call a function with each code of dictionary-encoded input
+ *
+ * A one-dimensional buffer of integers (such as a numpy array) is read
+ * directly, anything else is iterated over and each element is used
+ * as an index.
+ *
+ * \param codes The object holding the codes
+ * \param n_categories The number of categories, to report a code that is
+ *                     too large to even be a Py_ssize_t
+ * \param function A callable accepting each code as a Py_ssize_t
+ * \throw exception_is_set If the codes are not integers
+ */
+template <typename Function>
+static void for_each_code(
+    PyObject* codes, const Py_ssize_t n_categories, Function function
+) noexcept(false)
+{
+    if (!PyObject_CheckBuffer(codes)) {
+        IterableManager<Py_ssize_t> iter_man(codes, [&](PyObject* x) -> Py_ssize_t {
+            const Py_ssize_t code = PyNumber_AsSsize_t(x, PyExc_OverflowError);
+            if (code == -1 && PyErr_Occurred()) {
+                if (PyErr_ExceptionMatches(PyExc_OverflowError)) {
+                    PyErr_Clear();
+                    PyErr_Format(
+                        PyExc_ValueError,
+                        "category code %S is out of range for %zd categories",
+                        x,
+                        n_categories
+                    );
+                }
+                throw exception_is_set();
+            }
+            return code;
+        });
+        for (const auto& code : iter_man) {
+            function(code);
+        }
+        return;
+    }
+
+    Py_buffer buf { nullptr, nullptr };
+    if (PyObject_GetBuffer(codes, &buf, PyBUF_STRIDES | PyBUF_FORMAT) != 0) {
+        throw exception_is_set();
+    }
+    try {
+        if (buf.ndim != 1) {
+            PyErr_SetString(PyExc_ValueError, "codes must be one-dimensional");
+            throw exception_is_set();
+        }
+        const char* data = static_cast<const char*>(buf.buf);
+        const Py_ssize_t stride = buf.strides != nullptr ? buf.strides[0] : buf.itemsize;
+        bool integral = false;
+        const std::string_view format(buf.format == nullptr ? "B" : buf.format);
+        dispatch_on_format(format, [&](auto type) {
+            using C = decltype(type);
+            if constexpr (std::is_integral_v<C> && !std::is_same_v<C, bool>) {
+                integral = true;
+                constexpr auto max = std::numeric_limits<Py_ssize_t>::max();
+                for (Py_ssize_t i = 0; i < buf.shape[0]; ++i) {
+                    const C code = *reinterpret_cast<const C*>(data + (i * stride));
+                    if constexpr (std::is_unsigned_v<C> && sizeof(C) >= sizeof(max)) {
+                        if (code > static_cast<C>(max)) {
+                            PyErr_Format(
+                                PyExc_ValueError,
+                                "category code %llu is out of range for %zd categories",
+                                static_cast<unsigned long long>(code),
+                                n_categories
+                            );
+                            throw exception_is_set();
+                        }
+                        function(static_cast<Py_ssize_t>(code));
+                    } else {
+                        function(static_cast<Py_ssize_t>(code));
+                    }
+                }
+            }
+        });
+        if (!integral) {
+            PyErr_Format(
+                PyExc_TypeError,
+                "codes must be integers, not buffer of format '%s'",
+                buf.format
+            );
+            throw exception_is_set();
+        }
+    } catch (...) {
+        PyBuffer_Release(&buf);
+        throw;
+    }
+    PyBuffer_Release(&buf);
+}
+
+/**
+ * \struct ArrayImpl
+ * \brief Executor of array population, manages Python memory buffer
+ */
+struct ArrayImpl {
+    /// The input object as given by Python
+    PyObject* m_input;
+
+    /// The output object, represented as a memory view buffer
+    /// (nullptr if the output is to be created by streaming the input)
+    Py_buffer* m_output;
+
+    /// The action to take if INF is found
+    PyObject* m_inf;
+
+    /// The action to take if NaN is found
+    PyObject* m_nan;
+
+    /// The action to take if input is invalid
+    PyObject* m_on_fail;
+
+    /// The action to take if input overflows
+    PyObject* m_on_overflow;
+
+    /// The action to take if input is of incorrect type
+    PyObject* m_on_type_error;
+
+    /// Whether or not to allow underscores in strings
+    bool m_allow_underscores;
+
+    /// The base to use when parsing integers
+    int m_base;
+
+    /// The power of ten by which to scale integers (INT_MIN if not scaled)
+    int m_scale;
+
+    /// How floats are converted when the output is integral
+    FloatToInt m_float_to_int;
+
+    /// Whether or not a callable for on_fail accepts a list of inputs
+    bool m_batch_on_fail;
+
+    /// The buffer flagging elements that were not converted (nullptr if none)
+    Py_buffer* m_mask;
+
+    /// The input as an Arrow string array (nullptr if it is not one)
+    const ArrowStringArray* m_arrow;
+
+    /// The input as a numpy StringDType array (nullptr if it is not one)
+    NumpyStringArray* m_numpy_strings;
+
+    /// The categories indexed by the codes of dictionary-encoded input
+    /// (nullptr if the input is not dictionary-encoded)
+    PyObject* m_categories;
+
+    /// The number of elements first converted at a time when streaming
+    static constexpr std::size_t STREAM_CHUNK_SIZE = 1024;
+
+    /// The number of elements of a numeric buffer that are checked together
+    static constexpr Py_ssize_t CAST_BLOCK_SIZE = 256;
+
+    /// Whether or not the input is an array of strings that is read directly
+    bool has_text_cells() const noexcept
+    {
+        return m_arrow != nullptr || m_numpy_strings != nullptr;
+    }
+
+    /// The number of cells of an array of strings that is read directly
+    Py_ssize_t text_cell_count() const noexcept
+    {
+        return m_arrow != nullptr ? m_arrow->size() : m_numpy_strings->size();
+    }
+
+    /// Release the Python memoryview buffer
+    ~ArrayImpl() noexcept
+    {
+        if (m_output != nullptr) {
+            PyBuffer_Release(m_output);
+        }
+        if (m_mask != nullptr) {
+            PyBuffer_Release(m_mask);
+        }
+    }
+
+    /// Perform the actual array population logic
+    template <typename T>
+    void execute() noexcept(false)
+    {
+        // Define how a Python object can be converted into a C number type
+        CTypeExtractor<T> extractor(options());
+        configure(extractor);
+
+        if (m_output->ndim < 1) {
+            PyErr_SetString(
+                PyExc_ValueError, "Can only accept arrays of dimension 1 or greater"
+            );
+            throw exception_is_set();
+        }
+
+        // The optional mask is filled in the same (C) order as the output
+        Py_ssize_t size = 1;
+        for (int dim = 0; dim < m_output->ndim; ++dim) {
+            size *= m_output->shape[dim];
+        }
+        MaskPopulator mask(m_mask, size);
+
+        // Dictionary-encoded input converts each category once, then gathers
+        if (m_categories != nullptr) {
+            const Py_ssize_t length = m_output->shape[0];
+            ArrayPopulator pop(*m_output, length);
+            Py_ssize_t count = 0;
+            gather_categories(extractor, [&](const T value, const bool flagged) {
+                if (count == length) {
+                    raise_size_mismatch(0);
+                }
+                pop.place_next(value);
+                mask.place_next(flagged);
+                count += 1;
+            });
+            if (count != length) {
+                raise_size_mismatch(0);
+            }
+            return;
+        }
+
+        // The cells of an Arrow or StringDType array are read straight from
+        // their storage, without creating a str for each
+        if (has_text_cells() && m_output->ndim == 1) {
+            ArrayPopulator pop(*m_output, text_cell_count());
+            convert_text_cells(
+                extractor,
+                [&](const T value, const bool flagged, const bool deferred) {
+                    T* location = pop.place_next(value);
+                    mask.place_next(flagged);
+                    if (deferred) {
+                        extractor.defer_to(location);
+                    }
+                }
+            );
+            return extractor.resolve_deferred();
+        }
+
+        // A buffer of numbers (e.g. a numpy array) is cast straight into the output
+        if (m_output->ndim == 1 && cast_numeric_buffer(extractor, mask)) {
+            return extractor.resolve_deferred();
+        }
+
+        // Multi-dimensional output is filled by walking nested rows. If the
+        // length of the input is not known, check the size as we go rather
+        // than first copying the input into a list to find the size
+        const bool sized = PyList_Check(m_input) || PyTuple_Check(m_input)
+            || PySequence_Check(m_input);
+        if (m_output->ndim != 1 || !sized) {
+            populate_dimension(
+                extractor, mask, m_input, static_cast<char*>(m_output->buf), 0
+            );
+            return extractor.resolve_deferred();
+        }
+
+        // Define how we convert each element of the iterable
+        IterableManager<T> iter_man(m_input, [&extractor](PyObject* x) -> T {
+            return extractor.extract_c_number(x);
+        });
+
+        // Create a handler for inserting data into the output memory buffer
+        ArrayPopulator pop(*m_output, iter_man.get_size());
+
+        // Without a mask or a batched callable nothing but the value of each
+        // element is needed, so keep the bookkeeping out of the common loop
+        if (m_mask == nullptr && !extractor.may_defer()) {
+            for (const auto& value : iter_man) {
+                pop.place_next(value);
+            }
+            return;
+        }
+
+        // Iterate over the input data, convert it, and place it in the output
+        for (const auto& value : iter_man) {
+            T* location = pop.place_next(value);
+            mask.place_next(extractor.flagged());
+            if (extractor.deferred()) {
+                extractor.defer_to(location);
+            }
+        }
+        extractor.resolve_deferred();
+    }
+
+    /**
+     * \brief Append the converted elements of an iterable to an array.array
+     *
+     * The input is consumed once, in chunks that are converted into a small
+     * local buffer and then appended to the array, so memory use is
+     * proportional to the size of the output rather than of the input.
+     *
+     * \param output The array.array (or bytearray) to which to append
+     */
+    template <typename T>
+    void stream(PyObject* output) noexcept(false)
+    {
+        // Define how a Python object can be converted into a C number type
+        CTypeExtractor<T> extractor(options());
+        configure(extractor);
+
+        // The chunk doubles in size each time it is appended to the output,
+        // so the number of appends (each a Python call for an array.array)
+        // grows only with the logarithm of the length of the input
+        std::size_t capacity = STREAM_CHUNK_SIZE;
+        std::unique_ptr<T[]> chunk(new T[capacity]);
+        std::size_t size = 0;
+
+        // Whether the mask has a byte or a bit per element is only known
+        // from the final length, so the flags are kept until then
+        std::vector<unsigned char> flags;
+        auto add_to_chunk = [&](const T value, const bool flagged, const bool defer) {
+            if (m_mask != nullptr) {
+                flags.push_back(flagged);
+            }
+            chunk[size] = value;
+            if (defer) {
+                extractor.defer_to(&chunk[size]);
+            }
+            size += 1;
+            if (size == capacity) {
+                extractor.resolve_deferred();
+                append_bytes(output, chunk.get(), size * sizeof(T));
+                size = 0;
+                capacity *= 2;
+                chunk.reset(new T[capacity]);
+            }
+        };
+
+        if (m_categories != nullptr) {
+            gather_categories(extractor, [&](const T value, const bool flagged) {
+                add_to_chunk(value, flagged, false);
+            });
+        } else if (has_text_cells()) {
+            convert_text_cells(extractor, add_to_chunk);
+        } else {
+            IterableManager<T> iter_man(m_input, [&extractor](PyObject* x) -> T {
+                return extractor.extract_c_number(x);
+            });
+            for (const auto& value : iter_man) {
+                add_to_chunk(value, extractor.flagged(), extractor.deferred());
+            }
+        }
+        extractor.resolve_deferred();
+        append_bytes(output, chunk.get(), size * sizeof(T));
+
+        MaskPopulator mask(m_mask, static_cast<Py_ssize_t>(flags.size()));
+        for (const unsigned char flagged : flags) {
+            mask.place_next(flagged != 0);
+        }
+    }
+
+private:
+    /// The user options needed to convert the input
+    UserOptions options() const noexcept
+    {
+        UserOptions options;
+        options.set_base(m_base);
+        options.set_underscores_allowed(m_allow_underscores);
+        options.set_scale(m_scale);
+        options.set_float_to_int(m_float_to_int);
+        return options;
+    }
+
+    /**
+     * \brief Convert each cell of the Arrow or StringDType array input
+     *
+     * ASCII text is parsed straight from the storage of the array, and
+     * anything else is converted from a str. A missing cell is converted
+     * as None would be, so it is handled by on_type_error.
+     *
+     * \param extractor Converter of text into a C number
+     * \param place Callable accepting the value, flagged and deferred
+     *              state of each element
+     */
+    template <typename T, typename Function>
+    void convert_text_cells(CTypeExtractor<T>& extractor, Function place) const
+        noexcept(false)
+    {
+        struct Converted {
+            T value;
+            bool flagged;
+            bool deferred;
+        };
+        process_text_cells<Converted>(
+            m_arrow,
+            m_numpy_strings,
+            [&extractor](const std::string_view text) -> std::optional<Converted> {
+                const auto value
+                    = extractor.extract_c_number_in_place(text.data(), text.size());
+                if (!value) {
+                    return std::nullopt;
+                }
+                return Converted { *value, extractor.flagged(), false };
+            },
+            [&extractor](const std::optional<std::string_view>& text) -> Converted {
+                const T value = text
+                    ? extractor.extract_c_number(text->data(), text->size())
+                    : extractor.extract_c_number(Py_None);
+                return Converted { value, extractor.flagged(), extractor.deferred() };
+            },
+            [&place](const Converted& converted) {
+                place(converted.value, converted.flagged, converted.deferred);
+                return true;
+            }
+        );
+    }
+
+    /**
+     * \brief Convert dictionary-encoded input, each distinct category only once
+     *
+     * \param extractor Converter of a category into a C number
+     * \param place Callable accepting the value and flagged state of each element
+     */
+    template <typename T, typename Function>
+    void gather_categories(CTypeExtractor<T>& extractor, Function place) const
+        noexcept(false)
+    {
+        CategoryCache<T> cache(m_categories);
+        for_each_code(m_input, cache.size(), [&](const Py_ssize_t code) {
+            const auto& entry = cache.lookup(extractor, code);
+            place(entry.value, entry.flagged);
+        });
+    }
+
+    /**
+     * \brief Cast the elements of a one-dimensional buffer of numbers
+     *
+     * Each element is converted as the Python int or float that it holds
+     * would be. Blocks of elements are first checked together, and if none
+     * needs a replacement the block is cast without further checks. Other
+     * elements are converted through a Python object as usual.
+     *
+     * \param extractor Converter of a number into a C number
+     * \param mask Recorder of which elements were flagged by the extractor
+     * \return false if the input is not a buffer of integers or floats
+     */
+    template <typename T>
+    bool cast_numeric_buffer(CTypeExtractor<T>& extractor, MaskPopulator& mask) noexcept(
+        false
+    )
+    {
+        if (!PyObject_CheckBuffer(m_input)) {
+            return false;
+        }
+        Py_buffer input { nullptr, nullptr };
+        if (PyObject_GetBuffer(m_input, &input, PyBUF_STRIDES | PyBUF_FORMAT) != 0) {
+            // Leave it to iteration to report any problem with the input
+            PyErr_Clear();
+            return false;
+        }
+        bool numeric = false;
+        try {
+            const std::string_view format(input.format == nullptr ? "B" : input.format);
+            if (input.ndim == 1) {
+                dispatch_on_format(format, [&](auto type) {
+                    using S = decltype(type);
+                    if constexpr (std::is_arithmetic_v<S> && !std::is_same_v<S, bool>) {
+                        numeric = true;
+                        cast_elements<T, S>(extractor, mask, input);
+                    }
+                });
+            }
+        } catch (...) {
+            PyBuffer_Release(&input);
+            throw;
+        }
+        PyBuffer_Release(&input);
+        return numeric;
+    }
+
+    /// Cast the elements of type S of the given input buffer into the output
+    template <typename T, typename S>
+    void cast_elements(
+        CTypeExtractor<T>& extractor, MaskPopulator& mask, const Py_buffer& input
+    ) noexcept(false)
+    {
+        const Py_ssize_t size = input.shape[0];
+        const Py_ssize_t stride
+            = input.strides != nullptr ? input.strides[0] : input.itemsize;
+        const char* data = static_cast<const char*>(input.buf);
+        auto element = [data, stride](const Py_ssize_t index) -> S {
+            return *reinterpret_cast<const S*>(data + (index * stride));
+        };
+
+        ArrayPopulator pop(*m_output, size);
+        const bool direct = extractor.template casts_from<S>();
+        for (Py_ssize_t start = 0; start < size; start += CAST_BLOCK_SIZE) {
+            const Py_ssize_t stop = std::min(start + CAST_BLOCK_SIZE, size);
+
+            bool fits = direct;
+            if (direct) {
+                for (Py_ssize_t i = start; i < stop; ++i) {
+                    fits &= extractor.can_cast(element(i));
+                }
+            }
+            if (fits) {
+                for (Py_ssize_t i = start; i < stop; ++i) {
+                    pop.place_next(extractor.cast(element(i)));
+                    mask.place_next(false);
+                }
+                continue;
+            }
+
+            for (Py_ssize_t i = start; i < stop; ++i) {
+                const S value = element(i);
+                if (direct && extractor.can_cast(value)) {
+                    pop.place_next(extractor.cast(value));
+                    mask.place_next(false);
+                    continue;
+                }
+                T* location = pop.place_next(extract_as_python(extractor, value));
+                mask.place_next(extractor.flagged());
+                if (extractor.deferred()) {
+                    extractor.defer_to(location);
+                }
+            }
+        }
+    }
+
+    /// Convert a C number as the Python int or float that it represents
+    template <typename T, typename S>
+    static T extract_as_python(CTypeExtractor<T>& extractor, const S value) noexcept(
+        false
+    )
+    {
+        PyObject* number = nullptr;
+        if constexpr (std::is_floating_point_v<S>) {
+            number = PyFloat_FromDouble(static_cast<double>(value));
+        } else if constexpr (std::is_signed_v<S>) {
+            number = PyLong_FromLongLong(static_cast<long long>(value));
+        } else {
+            number = PyLong_FromUnsignedLongLong(static_cast<unsigned long long>(value));
+        }
+        if (number == nullptr) {
+            throw exception_is_set();
+        }
+        try {
+            const T result = extractor.extract_c_number(number);
+            Py_DECREF(number);
+            return result;
+        } catch (...) {
+            Py_DECREF(number);
+            throw;
+        }
+    }
+
+    /// Append raw bytes to the end of an array.array or bytearray
+    static void
+    append_bytes(PyObject* output, const void* data, const std::size_t nbytes) noexcept(false)
+    {
+        if (nbytes == 0) {
+            return;
+        }
+        if (PyByteArray_Check(output)) {
+            const Py_ssize_t size = PyByteArray_GET_SIZE(output);
+            const Py_ssize_t new_size = size + static_cast<Py_ssize_t>(nbytes);
+            if (PyByteArray_Resize(output, new_size) != 0) {
+                throw exception_is_set();
+            }
+            std::memcpy(PyByteArray_AS_STRING(output) + size, data, nbytes);
+            return;
+        }
+        PyObject* view = PyMemoryView_FromMemory(
+            static_cast<char*>(const_cast<void*>(data)),
+            static_cast<Py_ssize_t>(nbytes),
+            PyBUF_READ
+        );
+        if (view == nullptr) {
+            throw exception_is_set();
+        }
+        PyObject* result = PyObject_CallMethod(output, "frombytes", "O", view);
+        Py_DECREF(view);
+        if (result == nullptr) {
+            throw exception_is_set();
+        }
+        Py_DECREF(result);
+    }
+
+    /// Set the replacements of the extractor from the user's selections
+    template <typename T>
+    void configure(CTypeExtractor<T>& extractor) const noexcept(false)
+    {
+        // Only integers can hold a scaled number
+        if constexpr (!std::is_integral_v<T> || std::is_same_v<T, bool>) {
+            if (m_scale != std::numeric_limits<int>::min()) {
+                PyErr_Format(
+                    PyExc_TypeError,
+                    "scale is only supported for integer outputs, not C type '%s'",
+                    type_name<T>()
+                );
+                throw exception_is_set();
+            }
+        }
+
+        // Only integers (including booleans) have floats converted into them
+        if constexpr (!std::is_integral_v<T>) {
+            if (m_float_to_int != FloatToInt::RAISE) {
+                PyErr_Format(
+                    PyExc_TypeError,
+                    "float_to_int is only supported for integer outputs, "
+                    "not C type '%s'",
+                    type_name<T>()
+                );
+                throw exception_is_set();
+            }
+        }
+
+        // A scaled number cannot be rounded, it must be exact
+        const bool is_scaled = m_scale != std::numeric_limits<int>::min();
+        if (is_scaled && m_float_to_int != FloatToInt::RAISE) {
+            PyErr_SetString(
+                PyExc_ValueError, "scale and float_to_int cannot be used together"
+            );
+            throw exception_is_set();
+        }
+        extractor.set_inf_replacement(m_inf);
+        extractor.set_nan_replacement(m_nan);
+        extractor.set_fail_replacement(m_on_fail);
+        extractor.set_fail_batched(m_batch_on_fail);
+        extractor.set_overflow_replacement(m_on_overflow);
+        extractor.set_type_error_replacement(m_on_type_error);
+    }
+
+    /**
+     * \brief Fill one dimension of the output from a (possibly nested) iterable
+     *
+     * The innermost dimension converts each element into the output,
+     * all outer dimensions recurse on each element as a row of the next
+     * dimension. Strides are honored, so any memory layout is accepted.
+     *
+     * \param extractor Converter of a Python object into a C number
+     * \param mask Recorder of which elements were flagged by the extractor
+     * \param input The iterable holding the data for this dimension
+     * \param data Pointer to the first output element for this dimension
+     * \param dim The dimension being filled
+     */
+    template <typename T>
+    void populate_dimension(
+        CTypeExtractor<T>& extractor,
+        MaskPopulator& mask,
+        PyObject* input,
+        char* data,
+        const int dim
+    ) noexcept(false)
+    {
+        // Strings are iterable but are never treated as a row
+        if (PyUnicode_Check(input) || PyBytes_Check(input) || PyByteArray_Check(input)) {
+            PyErr_Format(
+                PyExc_TypeError,
+                "expected a nested iterable for dimension %d of the output, not '%s'",
+                dim,
+                Py_TYPE(input)->tp_name
+            );
+            throw exception_is_set();
+        }
+
+        const Py_ssize_t length = m_output->shape[dim];
+        const Py_ssize_t stride = m_output->strides[dim];
+        Py_ssize_t count = 0;
+
+        if (dim == m_output->ndim - 1) {
+            IterableManager<T> iter_man(input, [&extractor](PyObject* x) -> T {
+                return extractor.extract_c_number(x);
+            });
+            ArrayPopulator pop(data, stride);
+            for (const auto& value : iter_man) {
+                if (count == length) {
+                    raise_size_mismatch(dim);
+                }
+                T* location = pop.place_next(value);
+                mask.place_next(extractor.flagged());
+                if (extractor.deferred()) {
+                    extractor.defer_to(location);
+                }
+                count += 1;
+            }
+        } else {
+            // Each row is handed out as a new reference so that it stays
+            // alive while it is converted, even if it came from an iterator
+            IterableManager<PyObject*> rows(input, [](PyObject* row) -> PyObject* {
+                Py_INCREF(row);
+                return row;
+            });
+            for (PyObject* row : rows) {
+                try {
+                    if (count == length) {
+                        raise_size_mismatch(dim);
+                    }
+                    populate_dimension(
+                        extractor, mask, row, data + (count * stride), dim + 1
+                    );
+                } catch (...) {
+                    Py_DECREF(row);
+                    throw;
+                }
+                Py_DECREF(row);
+                count += 1;
+            }
+        }
+
+        if (count != length) {
+            raise_size_mismatch(dim);
+        }
+    }
+
+    /// Raise the error for an input not matching the output's shape
+    [[noreturn]] static void raise_size_mismatch(const int dim) noexcept(false)
+    {
+        PyErr_Format(
+            PyExc_ValueError, "input/output must be of equal size in dimension %d", dim
+        );
+        throw exception_is_set();
+    }
+};
+
+/**
+ * \brief Validate the selector is not a "yes, no, num, str, input" value
+ * \param selector The python object to validate
+ * \throws fastnumbers_exception if one of the four valid values
+ */
+static inline void validate_not_allow_disallow_str_only_num_only_input(
+    const PyObject* selector
+) noexcept(false)
+{
+    const bool bad = selector == Selectors::ALLOWED || selector == Selectors::DISALLOWED
+        || selector == Selectors::NUMBER_ONLY || selector == Selectors::STRING_ONLY
+        || selector == Selectors::INPUT;
+    if (bad) {
+        throw fastnumbers_exception(
+            "values for 'on_fail', 'on_overflow', and 'on_type_error' cannot be "
+            "fastnumbers.ALLOWED, fastnumbers.DISALLOWED, fastnumbers.NUMBER_ONLY, "
+            "fastnumbers.STRING_ONLY, or fastnumbers.INPUT"
+        );
+    }
+}
+
+/**
+ * \brief Validate the selector is not the clamp selector, which only
+ *        makes sense for overflows
+ * \param selector The python object to validate
+ * \throws fastnumbers_exception if given the clamp selector
+ */
+static inline void validate_not_clamp_input(const PyObject* selector) noexcept(false)
+{
+    if (selector == Selectors::CLAMP) {
+        throw fastnumbers_exception(
+            "fastnumbers.CLAMP is only allowed for 'on_overflow'"
+        );
+    }
+}
+
+/**
+ * \brief Validate the selector is not the skip selector, because an array
+ *        cannot leave out elements
+ * \param selector The python object to validate
+ * \throws fastnumbers_exception if given the skip selector
+ */
+static inline void validate_not_skip_input(const PyObject* selector) noexcept(false)
+{
+    if (selector == Selectors::SKIP) {
+        throw fastnumbers_exception("fastnumbers.SKIP is not allowed for try_array");
+    }
+}
+
+/**
+ * \brief Validate the selector is not a "no, num, str, input" value
+ * \param selector The python object to validate
+ * \throws fastnumbers_exception if one of the four valid values
+ */
+static inline void
+validate_not_disallow_str_only_num_only_input(const PyObject* selector) noexcept(false)
+{
+    const bool bad = selector == Selectors::DISALLOWED
+        || selector == Selectors::NUMBER_ONLY || selector == Selectors::STRING_ONLY
+        || selector == Selectors::INPUT || selector == Selectors::RAISE;
+    if (bad) {
+        throw fastnumbers_exception(
+            "values for 'inf' and 'nan' cannot be fastnumbers.DISALLOWED, "
+            "fastnumbers.NUMBER_ONLY, fastnumbers.STRING_ONLY, fastnumbers.INPUT "
+            "or fastnumbers.RAISE"
+        );
+    }
+}
+
+/**
+ * \brief Give the buffer of the mask (if one was given) to the ArrayImpl
+ *
+ * \param impl The array implementation, which will release the buffer
+ * \param mask The mask object, or nullptr or None if there is none
+ * \param buf Storage for the buffer, which must outlive impl
+ * \throw exception_is_set If the mask is not a writable bool or uint8 buffer
+ */
+static void acquire_mask(ArrayImpl& impl, PyObject* mask, Py_buffer& buf) noexcept(
+    false
+)
+{
+    if (mask == nullptr || mask == Py_None) {
+        return;
+    }
+    constexpr auto flags = PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS | PyBUF_FORMAT;
+    if (PyObject_GetBuffer(mask, &buf, flags) != 0) {
+        throw exception_is_set();
+    }
+    impl.m_mask = &buf;
+    const std::string_view format(buf.format == nullptr ? "B" : buf.format);
+    if (format != "?" && format != "B") {
+        PyErr_Format(
+            PyExc_TypeError,
+            "Buffer format for the mask must be '?' (bool) or 'B' (uint8), not "
+            "'%s' for object '%.200R'",
+            buf.format,
+            mask
+        );
+        throw exception_is_set();
+    }
+}
+
+// Implementation for iterating over a collection to populate an array
+void array_impl(
+    PyObject* input,
+    PyObject* output,
+    PyObject* inf,
+    PyObject* nan,
+    PyObject* on_fail,
+    PyObject* on_overflow,
+    PyObject* on_type_error,
+    bool allow_underscores,
+    int base,
+    int scale,
+    FloatToInt float_to_int,
+    bool batch_on_fail,
+    PyObject* mask,
+    PyObject* categories
+) noexcept(false)
+{
+    // Ensure the given parameters are valid.
+    validate_not_disallow_str_only_num_only_input(inf);
+    validate_not_disallow_str_only_num_only_input(nan);
+    validate_not_allow_disallow_str_only_num_only_input(on_fail);
+    validate_not_allow_disallow_str_only_num_only_input(on_overflow);
+    validate_not_allow_disallow_str_only_num_only_input(on_type_error);
+    validate_not_clamp_input(inf);
+    validate_not_clamp_input(nan);
+    validate_not_clamp_input(on_fail);
+    validate_not_clamp_input(on_type_error);
+    validate_not_skip_input(inf);
+    validate_not_skip_input(nan);
+    validate_not_skip_input(on_fail);
+    validate_not_skip_input(on_overflow);
+    validate_not_skip_input(on_type_error);
+
+    // Arrow and numpy StringDType arrays are read directly rather than
+    // iterated over, unless the input is the codes of dictionary-encoded data
+    if (categories == Py_None) {
+        categories = nullptr;
+    }
+    ArrowStringArray arrow(categories == nullptr ? input : Py_None);
+    NumpyStringArray numpy_strings(categories == nullptr ? input : Py_None);
+
+    // Extract the underlying buffer data from the output object
+    Py_buffer buf { nullptr, nullptr };
+    constexpr auto flags = PyBUF_WRITABLE | PyBUF_STRIDES | PyBUF_FORMAT;
+    if (PyObject_GetBuffer(output, &buf, flags) != 0) {
+        // This should be impossible to encounter because of guards in the python code
+        throw exception_is_set();
+    }
+
+    // Pass on all arguments to the actual implementation
+    // NOTE: This will manage the buffer objects (output and mask) for us
+    Py_buffer mask_buf { nullptr, nullptr };
+    ArrayImpl impl {
+        input, &buf, inf, nan, on_fail, on_overflow, on_type_error, allow_underscores,
+        base, scale, float_to_int, batch_on_fail, nullptr, arrow ? &arrow : nullptr,
+        numpy_strings ? &numpy_strings : nullptr, categories,
+    };
+
+    // Extract the buffer of the mask as well, if one was given
+    acquire_mask(impl, mask, mask_buf);
+
+    // Use the format to determine the code path to execute
+    const std::string_view format(buf.format == nullptr ? "<NULL>" : buf.format);
+    const bool known = dispatch_on_format(format, [&impl](auto type) {
+        impl.execute<decltype(type)>();
+    });
+    if (known) {
+        return;
     }
 
     // This should be impossible to encounter because of guards in the python code
@@ -545,4 +2072,182 @@ void array_impl(
         output
     );
     throw exception_is_set();
+}
+
+/// The array.array type, imported when the module is executed
+static PyObject* array_type = nullptr;
+
+int import_array_type() noexcept
+{
+    if (array_type != nullptr) {
+        return 0;
+    }
+    PyObject* module = PyImport_ImportModule("array");
+    if (module == nullptr) {
+        return -1;
+    }
+    array_type = PyObject_GetAttrString(module, "array");
+    Py_DECREF(module);
+    return array_type == nullptr ? -1 : 0;
+}
+
+/**
+ * \brief Create an array.array of the C type T holding the converted input
+ *
+ * array.array has no half precision or boolean typecodes, so for those
+ * a bytearray of the raw native values is returned instead.
+ *
+ * \param impl The array implementation (without an output buffer)
+ * \param typecode The array.array typecode matching T
+ * \return A new reference to the array.array (or bytearray)
+ */
+template <typename T>
+static PyObject* allocate_and_populate(ArrayImpl& impl, const char* typecode) noexcept(
+    false
+)
+{
+    PyObject* input = impl.m_input;
+    constexpr bool raw = std::is_same_v<T, Half> || std::is_same_v<T, bool>;
+
+    // A sequence need not have a length (e.g. if it only defines
+    // __getitem__), in which case it is iterated like any other input
+    Py_ssize_t length = -1;
+    if (impl.has_text_cells()) {
+        length = impl.text_cell_count();
+    } else if (PySequence_Check(input)) {
+        length = PySequence_Size(input);
+        if (length < 0) {
+            if (!PyErr_ExceptionMatches(PyExc_TypeError)) {
+                throw exception_is_set();
+            }
+            PyErr_Clear();
+        }
+    }
+
+    // Without a length, stream the input into an initially empty array
+    if (length < 0 || raw) {
+        PyObject* output = raw
+            ? PyByteArray_FromStringAndSize(nullptr, 0)
+            : PyObject_CallFunction(array_type, "s", typecode);
+        if (output == nullptr) {
+            throw exception_is_set();
+        }
+        try {
+            impl.stream<T>(output);
+        } catch (...) {
+            Py_DECREF(output);
+            throw;
+        }
+        return output;
+    }
+
+    // Otherwise allocate the full (zeroed) array up front and fill it in place
+    PyObject* single = PyObject_CallFunction(array_type, "s(i)", typecode, 0);
+    if (single == nullptr) {
+        throw exception_is_set();
+    }
+    PyObject* output = PySequence_Repeat(single, length);
+    Py_DECREF(single);
+    if (output == nullptr) {
+        throw exception_is_set();
+    }
+
+    Py_buffer buf { nullptr, nullptr };
+    constexpr auto flags = PyBUF_WRITABLE | PyBUF_STRIDES | PyBUF_FORMAT;
+    if (PyObject_GetBuffer(output, &buf, flags) != 0) {
+        Py_DECREF(output);
+        throw exception_is_set();
+    }
+    try {
+        // The buffers are released when filler goes out of scope
+        ArrayImpl filler = impl;
+        filler.m_output = &buf;
+        impl.m_mask = nullptr;
+        filler.execute<T>();
+    } catch (...) {
+        Py_DECREF(output);
+        throw;
+    }
+    return output;
+}
+
+// Implementation for converting an iterable into a newly allocated array
+PyObject* array_alloc_impl(
+    PyObject* input,
+    PyObject* typecode,
+    PyObject* inf,
+    PyObject* nan,
+    PyObject* on_fail,
+    PyObject* on_overflow,
+    PyObject* on_type_error,
+    bool allow_underscores,
+    int base,
+    int scale,
+    FloatToInt float_to_int,
+    bool batch_on_fail,
+    PyObject* mask,
+    PyObject* categories
+) noexcept(false)
+{
+    // Ensure the given parameters are valid.
+    validate_not_disallow_str_only_num_only_input(inf);
+    validate_not_disallow_str_only_num_only_input(nan);
+    validate_not_allow_disallow_str_only_num_only_input(on_fail);
+    validate_not_allow_disallow_str_only_num_only_input(on_overflow);
+    validate_not_allow_disallow_str_only_num_only_input(on_type_error);
+    validate_not_clamp_input(inf);
+    validate_not_clamp_input(nan);
+    validate_not_clamp_input(on_fail);
+    validate_not_clamp_input(on_type_error);
+    validate_not_skip_input(inf);
+    validate_not_skip_input(nan);
+    validate_not_skip_input(on_fail);
+    validate_not_skip_input(on_overflow);
+    validate_not_skip_input(on_type_error);
+
+    // The default is to create an array of doubles
+    const char* typecode_str = "d";
+    if (typecode != nullptr && typecode != Py_None) {
+        if (!PyUnicode_Check(typecode)) {
+            PyErr_Format(
+                PyExc_TypeError,
+                "dtype must be an array typecode of type 'str', not '%s'",
+                Py_TYPE(typecode)->tp_name
+            );
+            throw exception_is_set();
+        }
+        if ((typecode_str = PyUnicode_AsUTF8(typecode)) == nullptr) {
+            throw exception_is_set();
+        }
+    }
+
+    // Arrow and numpy StringDType arrays are read directly rather than
+    // iterated over, unless the input is the codes of dictionary-encoded data
+    if (categories == Py_None) {
+        categories = nullptr;
+    }
+    ArrowStringArray arrow(categories == nullptr ? input : Py_None);
+    NumpyStringArray numpy_strings(categories == nullptr ? input : Py_None);
+
+    // The mask buffer (if any) is released by impl
+    Py_buffer mask_buf { nullptr, nullptr };
+    ArrayImpl impl {
+        input, nullptr, inf, nan, on_fail, on_overflow, on_type_error, allow_underscores,
+        base, scale, float_to_int, batch_on_fail, nullptr, arrow ? &arrow : nullptr,
+        numpy_strings ? &numpy_strings : nullptr, categories,
+    };
+    acquire_mask(impl, mask, mask_buf);
+
+    // Use the typecode to determine the code path to execute
+    PyObject* result = nullptr;
+    const bool known
+        = dispatch_on_format(typecode_str, [&impl, &result, typecode_str](auto type) {
+              result = allocate_and_populate<decltype(type)>(impl, typecode_str);
+          });
+    if (known) {
+        return result;
+    }
+
+    PyErr_Format(PyExc_TypeError, "Unknown buffer format '%s'", typecode_str);
+    throw exception_is_set();
 }
\ No newline at end of file
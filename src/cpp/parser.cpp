@@ -43,7 +43,8 @@ static PyObject* parse_long_helper(
         // This Python parse won't let us specify the end of the string, and it errors
         // out on non-numeric characters, so we have to copy our data to a buffer
         // and set the exponent character to '\0' so that Python can parse it.
-        Buffer buffer(start, length_to_end);
+        Buffer buffer;
+        buffer.copy_terminated(start, length_to_end);
         buffer.mark_integer_end();
         return PyLong_FromString(buffer.start(), nullptr, 10);
     }
@@ -303,8 +304,9 @@ CharacterParser::CharacterParser(
     // Store the end point of the character array
     const char* end = m_end_orig;
 
-    // Strip leading whitespace
-    while (is_whitespace(*m_start)) {
+    // Strip leading whitespace. The data need not be nul-terminated
+    // (e.g. a slice of a memoryview), so never look past the end.
+    while (m_start != end && is_whitespace(*m_start)) {
         m_start += 1;
     }
 
@@ -312,9 +314,9 @@ CharacterParser::CharacterParser(
     strip_trailing_whitespace(m_start, end);
 
     // Remove the sign if present and remember what it represents
-    if (*m_start == '+') {
+    if (m_start != end && *m_start == '+') {
         m_start += 1;
-    } else if (*m_start == '-') {
+    } else if (m_start != end && *m_start == '-') {
         m_start += 1;
         set_negative();
     }
@@ -323,7 +325,7 @@ CharacterParser::CharacterParser(
     // Two or more signs is illegal - let's treat it as such.
     // Reset the start to before the first sign.
     // All parsers will treat this as illegal now.
-    if (is_sign(*m_start)) {
+    if (m_start != end && is_sign(*m_start)) {
         m_start -= 1;
         set_negative(false);
     }
@@ -368,8 +370,12 @@ RawPayload<PyObject*> CharacterParser::as_pyint() const noexcept(false)
     // Parse and record the location where parsing ended (including trailing
     // whitespace) No need to do input validation with the second argument because we
     // already know the input is valid from above. Return the value without checking
-    // python's error state.
-    return PyLong_FromString(m_start_orig, nullptr, options().get_base());
+    // python's error state. Python needs the string to be nul-terminated,
+    // which the original data need not be, so parse a copy.
+    Buffer text;
+    const auto len_orig = static_cast<std::size_t>(m_end_orig - m_start_orig);
+    text.copy_terminated(m_start_orig, len_orig);
+    return PyLong_FromString(text.start(), nullptr, options().get_base());
 }
 
 RawPayload<PyObject*> CharacterParser::as_pyfloat(
@@ -2,6 +2,8 @@
 
 from __future__ import annotations
 
+import enum
+from array import typecodes as _array_typecodes
 from typing import TYPE_CHECKING
 
 try:
@@ -12,11 +14,16 @@ except ImportError:
     __version_tuple__ = (0, 0, "unknown version")
 from .fastnumbers import (
     ALLOWED,
+    CLAMP,
     DISALLOWED,
     INPUT,
     NUMBER_ONLY,
     RAISE,
+    SKIP,
     STRING_ONLY,
+    all_float,
+    all_int,
+    any_invalid,
     check_float,
     check_int,
     check_intlike,
@@ -25,6 +32,7 @@ from .fastnumbers import (
     fast_forceint,
     fast_int,
     fast_real,
+    first_invalid_index,
     float,
     int,
     isfloat,
@@ -32,20 +40,41 @@ from .fastnumbers import (
     isintlike,
     isreal,
     query_type,
+    query_type_codes,
     real,
     try_float,
     try_forceint,
     try_int,
     try_real,
+    try_scaled_int,
 )
 from .fastnumbers import (
     array as _array,
 )
 
+
+class TypeCode(enum.IntEnum):
+    """
+    Codes used by :func:`query_type_codes` to classify each element.
+
+    The values match the indices of the counts returned by
+    :func:`query_type_codes`.
+    """
+
+    INT = 0
+    FLOAT = 1
+    INTLIKE = 2
+    NAN = 3
+    INF = 4
+    INVALID = 5
+    OTHER = 6
+
+
 try:
     import numpy as np
 except ImportError:
     has_numpy = False
+    _dtype_typecodes = {None: "d"}
 else:
     has_numpy = True
     _allowed_dtypes = {
@@ -57,35 +86,65 @@ else:
         np.uint32,
         np.int64,
         np.uint64,
+        np.float16,
         np.float32,
         np.float64,
+        np.bool_,
     }
 
+    # Map the supported dtypes to the matching array.array typecode. Both the
+    # scalar types (e.g. np.float64) and dtype objects are accepted as keys.
+    _dtype_typecodes = {None: "d"}
+    for _dtype in map(np.dtype, _allowed_dtypes):
+        _dtype_typecodes[_dtype] = _dtype_typecodes[_dtype.type] = _dtype.char
+    del _dtype
+
+
+def _typecode(dtype):
+    """Get the array.array typecode corresponding to the given dtype."""
+    try:
+        return _dtype_typecodes[dtype]
+    except (KeyError, TypeError):
+        pass
+    if has_numpy:
+        dtype = np.dtype(dtype)
+        return dtype.char if dtype.isnative else dtype.str
+    # Let the C++ code validate the typecode
+    return dtype
+
+
 # Hide all type checking code at runtime behind this gate
 if TYPE_CHECKING:
     import array
-    from collections.abc import Iterable
-    from typing import Any, Callable, NewType, TypeVar, overload
+    from collections.abc import Iterable, Sequence
+    from typing import Any, Callable, Literal, NewType, TypeVar, overload
 
     IntT = TypeVar("IntT", np.int_)
     FloatT = TypeVar("FloatT", np.float64)
     CallToInt = Callable[[Any], int]
     CallToFloat = Callable[[Any], float]
+    BatchedCallable = Callable[[list[Any]], Sequence[Any]]
+    FloatToIntT = Literal["raise", "truncate", "round", "intlike"]
+    MaskT = np.ndarray[Any] | bytearray | array.array[int] | None
     ALLOWED_T = NewType("ALLOWED_T", object)
     RAISE_T = NewType("RAISE_T", object)
 
     ALLOWED_T = NewType("ALLOWED_T", object)
+    CLAMP_T = NewType("CLAMP_T", object)
     DISALLOWED_T = NewType("DISALLOWED_T", object)
     INPUT_T = NewType("INPUT_T", object)
     RAISE_T = NewType("RAISE_T", object)
+    SKIP_T = NewType("SKIP_T", object)
     STRING_ONLY_T = NewType("STRING_ONLY_T", object)
     NUMBER_ONLY_T = NewType("NUMBER_ONLY_T", object)
 
     # Selectors
     ALLOWED: ALLOWED_T
+    CLAMP: CLAMP_T
     DISALLOWED: DISALLOWED_T
     INPUT: INPUT_T
     RAISE: RAISE_T
+    SKIP: SKIP_T
     STRING_ONLY: STRING_ONLY_T
     NUMBER_ONLY: NUMBER_ONLY_T
 
@@ -97,10 +156,15 @@ if TYPE_CHECKING:
         dtype: IntT,
         inf: ALLOWED_T | int | CallToInt = ALLOWED,
         nan: ALLOWED_T | int | CallToInt = ALLOWED,
-        on_fail: RAISE_T | int | CallToInt = RAISE,
-        on_overflow: RAISE_T | int | CallToInt = RAISE,
+        on_fail: RAISE_T | int | CallToInt | BatchedCallable = RAISE,
+        batch_on_fail: bool = False,
+        on_overflow: RAISE_T | CLAMP_T | int | CallToInt = RAISE,
         on_type_error: RAISE_T | int | CallToInt = RAISE,
         base: int = 10,
+        scale: int | None = None,
+        float_to_int: FloatToIntT = "raise",
+        mask: MaskT = None,
+        categories: Sequence[Any] | None = None,
         allow_underscores: bool = False,
     ) -> np.ndarray[IntT]: ...
 
@@ -112,10 +176,15 @@ if TYPE_CHECKING:
         dtype: FloatT = np.float64,
         inf: ALLOWED_T | int | float | CallToInt | CallToFloat = ALLOWED,
         nan: ALLOWED_T | int | float | CallToInt | CallToFloat = ALLOWED,
-        on_fail: RAISE_T | int | float | CallToInt | CallToFloat = RAISE,
+        on_fail: (
+            RAISE_T | int | float | CallToInt | CallToFloat | BatchedCallable
+        ) = RAISE,
+        batch_on_fail: bool = False,
         on_overflow: RAISE_T | int | float | CallToInt | CallToFloat = RAISE,
         on_type_error: RAISE_T | int | float | CallToInt | CallToFloat = RAISE,
         base: int = 10,
+        mask: MaskT = None,
+        categories: Sequence[Any] | None = None,
         allow_underscores: bool = False,
     ) -> np.ndarray[FloatT]: ...
 
@@ -126,10 +195,15 @@ if TYPE_CHECKING:
         *,
         inf: ALLOWED_T | int | CallToInt = ALLOWED,
         nan: ALLOWED_T | int | CallToInt = ALLOWED,
-        on_fail: RAISE_T | int | CallToInt = RAISE,
-        on_overflow: RAISE_T | int | CallToInt = RAISE,
+        on_fail: RAISE_T | int | CallToInt | BatchedCallable = RAISE,
+        batch_on_fail: bool = False,
+        on_overflow: RAISE_T | CLAMP_T | int | CallToInt = RAISE,
         on_type_error: RAISE_T | int | CallToInt = RAISE,
         base: int = 10,
+        scale: int | None = None,
+        float_to_int: FloatToIntT = "raise",
+        mask: MaskT = None,
+        categories: Sequence[Any] | None = None,
         allow_underscores: bool = False,
     ) -> None: ...
 
@@ -140,10 +214,15 @@ if TYPE_CHECKING:
         *,
         inf: ALLOWED_T | int | float | CallToInt | CallToFloat = ALLOWED,
         nan: ALLOWED_T | int | float | CallToInt | CallToFloat = ALLOWED,
-        on_fail: RAISE_T | int | float | CallToInt | CallToFloat = RAISE,
+        on_fail: (
+            RAISE_T | int | float | CallToInt | CallToFloat | BatchedCallable
+        ) = RAISE,
+        batch_on_fail: bool = False,
         on_overflow: RAISE_T | int | float | CallToInt | CallToFloat = RAISE,
         on_type_error: RAISE_T | int | float | CallToInt | CallToFloat = RAISE,
         base: int = 10,
+        mask: MaskT = None,
+        categories: Sequence[Any] | None = None,
         allow_underscores: bool = False,
     ) -> None: ...
 
@@ -154,10 +233,15 @@ if TYPE_CHECKING:
         *,
         inf: ALLOWED_T | int | CallToInt = ALLOWED,
         nan: ALLOWED_T | int | CallToInt = ALLOWED,
-        on_fail: RAISE_T | int | CallToInt = RAISE,
-        on_overflow: RAISE_T | int | CallToInt = RAISE,
+        on_fail: RAISE_T | int | CallToInt | BatchedCallable = RAISE,
+        batch_on_fail: bool = False,
+        on_overflow: RAISE_T | CLAMP_T | int | CallToInt = RAISE,
         on_type_error: RAISE_T | int | CallToInt = RAISE,
         base: int = 10,
+        scale: int | None = None,
+        float_to_int: FloatToIntT = "raise",
+        mask: MaskT = None,
+        categories: Sequence[Any] | None = None,
         allow_underscores: bool = False,
     ) -> None: ...
 
@@ -168,10 +252,15 @@ if TYPE_CHECKING:
         *,
         inf: ALLOWED_T | int | float | CallToInt | CallToFloat = ALLOWED,
         nan: ALLOWED_T | int | float | CallToInt | CallToFloat = ALLOWED,
-        on_fail: RAISE_T | int | float | CallToInt | CallToFloat = RAISE,
+        on_fail: (
+            RAISE_T | int | float | CallToInt | CallToFloat | BatchedCallable
+        ) = RAISE,
+        batch_on_fail: bool = False,
         on_overflow: RAISE_T | int | float | CallToInt | CallToFloat = RAISE,
         on_type_error: RAISE_T | int | float | CallToInt | CallToFloat = RAISE,
         base: int = 10,
+        mask: MaskT = None,
+        categories: Sequence[Any] | None = None,
         allow_underscores: bool = False,
     ) -> None: ...
 
@@ -188,18 +277,33 @@ def try_array(input, output=None, *, dtype=None, **kwargs):  # noqa: A002, D417
     Parameters
     ----------
     input
-        The iterable of values to convert into an array.
+        The iterable of values to convert into an array. An iterable of
+        unknown length (e.g. a generator) is consumed only once, and is not
+        first copied into a list. An Arrow string or large string array (any
+        object with an ``__arrow_c_array__`` method, such as a ``pyarrow``
+        array) is read directly from its buffers, as is a one-dimensional
+        *numpy* ``StringDType`` array; null elements are treated as *None*
+        would be, and so are handled by ``on_type_error``. A one-dimensional
+        buffer of numbers (e.g. a ``numpy.ndarray`` of integers or floats) is
+        cast straight into the output, each element being converted as the
+        Python *int* or *float* it holds would be.
     output : optional
         If specified, it is an already existing array object that will contain
-        the converted data. It must be of the same length as the input, and
-        must be one-dimensional (though a 1D slice of a multi-dimensional array
-        is allowed). ``numpy.ndarray`` and ``array.array`` types are allowed.
-        If *None*, a ``numpy.ndarray`` will be created for you and will be
-        returned as the return value.
+        the converted data. It must be of the same length as the input.
+        ``numpy.ndarray`` and ``array.array`` types are allowed. If it is
+        multi-dimensional, the input must be a nested iterable of rows (e.g. a
+        list of lists) matching the shape of ``output``, and each innermost
+        element is converted; any memory layout (C or Fortran order, or a
+        strided slice) is accepted. If *None*, a one-dimensional
+        ``numpy.ndarray`` (or ``array.array`` if *numpy* is not installed) will
+        be created for you and will be returned as the return value.
     dtype : optional
         If ``output`` is *None*, this specifies the *dtype* of the returned
         ``ndarray``. The default is ``np.float64``. The *dtype* must be of
-        integral or float type. Ignored if ``output`` is not *None*.
+        integral, float (including ``np.float16``), or boolean type. An
+        ``array.array`` typecode (e.g. ``"i"``) is also accepted, and is the
+        only option if *numpy* is not installed.
+        Ignored if ``output`` is not *None*.
     inf : optional
         Control how INF is interpreted/handled. The default is *ALLOWED*, which
         indicates that both the string \"inf\" or the float INF are accepted.
@@ -216,10 +320,18 @@ def try_array(input, output=None, *, dtype=None, **kwargs):  # noqa: A002, D417
         callable accepting a single argument that will be called with the input to
         return an alternate value, or a default value to be returned instead of the
         input.
+    batch_on_fail : bool, optional
+        If *True* and ``on_fail`` is a callable, the callable is given a *list*
+        of failing inputs and must return a sequence with one replacement per
+        input. Failures are collected and given to the callable in chunks, so
+        it is called far less often than once per failure. The default is
+        *False*.
     on_overflow : optional
         Control what happens when the input does not fit in the desired output data
         type. Behavior matches that of ``on_fail`` except that a *OverflowError* is
-        raised instead of *ValueError*.
+        raised instead of *ValueError*. Additionally, *CLAMP* may be given to
+        store the closest value that fits (the minimum or maximum of the
+        *dtype*, depending on the sign of the input).
     on_type_error : optional
         Control what happens when the input is neither numeric nor string. Behavior
         matches that of ``on_fail`` except that a *TypeError* is raised instead of
@@ -228,6 +340,47 @@ def try_array(input, output=None, *, dtype=None, **kwargs):  # noqa: A002, D417
         Follows the rules of Python's built-in :func:*int*; see it's
         documentation for your Python version. If given, the input
         **must** be of type *str*. Ignored if the *dtype* is not integral.
+    scale : int, optional
+        If given, each input is read as a fixed-point decimal and stored as
+        the integer ``x * 10**scale``, exactly as :func:`try_scaled_int` does
+        (so ``"12.34"`` with ``scale=2`` is stored as ``1234``). An input
+        whose value would lose non-zero digits is a failure handled by
+        ``on_fail``. Only allowed if the *dtype* is integral (but not boolean).
+    float_to_int : str, optional
+        Control how a float (e.g. ``"2.7"``, ``"1e3"``, or ``2.7``) is stored
+        when the *dtype* is integral. The default is ``"raise"``, which treats
+        all floats as invalid input (handled by ``on_fail``). ``"truncate"``
+        rounds toward zero, ``"round"`` rounds to nearest (ties to even), and
+        ``"intlike"`` only accepts floats with no fractional part. Strings are
+        converted exactly from their digits, never through a *float*. NaN and
+        infinity are always invalid, and a result that does not fit is handled
+        by ``on_overflow``. Any value other than ``"raise"`` is a *TypeError*
+        if the *dtype* is not integral.
+    mask : optional
+        If specified, a writable array that is filled in the same pass as the
+        output with one flag per element: 1 (*True*) if the element failed to
+        convert, overflowed, was of the wrong type, or was NaN, and 0 otherwise.
+        The flag is set no matter what replacement was stored in the output, so
+        a replacement (e.g. ``on_fail=0``) should be given instead of *RAISE*.
+        It may have one byte per element (e.g. an ``np.bool_`` or ``np.uint8``
+        array), or be a bitmap with one bit per element, least-significant bit
+        first (as for ``np.packbits`` with ``bitorder="little"``). The flags
+        are stored in C (row-major) order of the elements of ``output``,
+        whatever its memory layout, so a C-contiguous mask of the same shape
+        lines up with it. If ``output`` is *None*, an input of unknown length
+        is still consumed only once, and the size of the mask is checked when
+        the input is exhausted. This allows e.g. a ``numpy.ma.MaskedArray`` to
+        be built without checking the input a second time.
+    categories : optional
+        If specified, the input is dictionary-encoded (e.g. the ``codes`` of a
+        ``pandas.Categorical``): each element of ``input`` is an integer index
+        into ``categories``, which may be any sequence or an Arrow string array.
+        Each category is converted only once, the first time it is used, and
+        its result is stored for every element with that code, so a callable
+        given to ``inf``, ``nan``, or ``on_fail`` is called once per distinct
+        category. A code of -1 marks a missing element, which is treated as
+        *None* would be and so is handled by ``on_type_error``. Codes given
+        as a one-dimensional integer array are read directly from memory.
     allow_underscores : bool, optional
         Underscores are allowed in numeric literals and in strings passed to *int*
         or *float* (see PEP 515 for details on what is and is not allowed). You can
@@ -239,6 +392,8 @@ def try_array(input, output=None, *, dtype=None, **kwargs):  # noqa: A002, D417
     ndarray
         If ``output`` was *None*, this function will return the result in a numpy
         ndarray of the specified *dtype*.
+    array.array
+        If ``output`` was *None* and *numpy* is not installed.
     None
         If ``output`` was not *None*
 
@@ -249,13 +404,25 @@ def try_array(input, output=None, *, dtype=None, **kwargs):  # noqa: A002, D417
         set to *RAISE*.
     OverflowError
         If the input cannot fit into the desired *dtype* and the *dtype* is of
-        integral type and ``on_overflow`` is set to *RAISE*.
+        integral type and ``on_overflow`` is set to *RAISE*. For a boolean
+        *dtype* only 0 and 1 fit.
     ValueError
         If ``on_fail`` is set to *RAISE* and a triggering event is set.
     TypeError
         If ``output`` is given and it is of an invalid type (including data type).
-    RuntimeError
-        If ``output`` is not *None* but *numpy* is not installed.
+    TypeError
+        If ``scale`` is given and the *dtype* is not integral.
+    ValueError
+        If ``float_to_int`` is not one of the allowed values, or is given
+        together with ``scale``.
+    ValueError
+        If *CLAMP* is given to anything other than ``on_overflow``.
+    TypeError
+        If ``mask`` is not a bool or uint8 buffer.
+    ValueError
+        If ``mask`` has neither one byte nor one bit per element of the output.
+    ValueError
+        If ``categories`` is given and a code is neither -1 nor a valid index.
     TypeError
         If the value (or return value of the callable) given to `inf,` `nan`,
         ``on_fail``, ``on_overflow``, or ``on_type_error`` is not a float or int.
@@ -278,63 +445,86 @@ def try_array(input, output=None, *, dtype=None, **kwargs):  # noqa: A002, D417
         >>> try_array(["5", "3", "8"], output=output)
         >>> np.array_equal(output, np.array([5, 3, 8], dtype=np.int32))
         True
+        >>> output = np.empty((2, 2))
+        >>> try_array([["5", "3"], ["8", "nan"]], output=output)
+        >>> output
+        array([[ 5.,  3.],
+               [ 8., nan]])
+        >>> try_array(["12.34", "-0.5", "7"], dtype=np.int64, scale=2)
+        array([1234,  -50,  700])
+        >>> try_array(["2.5", "3.5", "1e3"], dtype=np.int64, float_to_int="round")
+        array([   2,    4, 1000])
+        >>> from fastnumbers import CLAMP
+        >>> try_array(["300", "-300", "5"], dtype=np.int8, on_overflow=CLAMP)
+        array([ 127, -128,    5], dtype=int8)
+        >>> try_array(["5", "bad", "worse"], on_fail=lambda x: [len(y) for y in x],
+        ...           batch_on_fail=True)
+        array([5., 3., 5.])
+        >>> mask = np.empty(4, dtype=bool)
+        >>> try_array(["5", "bad", "nan", "8"], on_fail=0.0, mask=mask)
+        array([ 5.,  0., nan,  8.])
+        >>> mask
+        array([False,  True,  True, False])
+        >>> try_array([2, 0, 0, -1, 2], categories=["1.5", "bad", "7"],
+        ...           on_type_error=0.0)
+        array([7. , 1.5, 1.5, 0. , 7. ])
 
     """
-    # If output is not provided, we construct a numpy array of the same length
-    # as the input into which the C++ function can populate the output.
+    # If output is not provided, the C++ function creates an array.array of the
+    # appropriate length and type (or a bytearray for float16 and bool, which
+    # array.array does not support). If numpy is installed, this is returned as
+    # an ndarray without copying the data, except that when the length is
+    # known up front it is cheaper to just let numpy allocate the output.
     if output is None:
-        return_output = True
-
-        # Construct a numpy ndarray of the appropriate length and
-        # dtype to contain the output.
+        typecode = _typecode(dtype)
+        # The C++ code can only give an array.array for these typecodes
+        if not has_numpy and typecode not in _array_typecodes:
+            msg = f"Unknown buffer format '{typecode}'"
+            raise TypeError(msg)
         if not has_numpy:
-            msg = (
-                "To use fastnumbers.try_array without an explict "
-                "output requires numpy to also be installed"
-            )
-            raise RuntimeError(msg)
+            return _array(input, dtype=typecode, **kwargs)
         try:
-            length = len(input)
+            output = np.empty(len(input), dtype=typecode)
         except TypeError:
-            input = list(input)  # noqa: A001
-            length = len(input)
-        output = np.empty(length, dtype=dtype or np.float64)
-    else:
-        return_output = False
-
-        # Let's be conservative about what we feed to the C++ code.
-        try:
-            if output.dtype.type not in _allowed_dtypes:
-                raise TypeError(
-                    "The only supported numpy dtypes for output are: "
-                    + ", ".join(sorted([x.__name__ for x in _allowed_dtypes]))
-                    + f" not {output.dtype.name}"
-                )
-        except AttributeError:
-            if not hasattr(output, "typecode"):
-                msg = (
-                    "Only numpy ndarray and array.array types for output are "
-                    f"supported, not {type(output)}"
-                )
-                raise TypeError(msg) from None
+            result = _array(input, dtype=typecode, **kwargs)
+            return np.frombuffer(result, dtype=typecode)
+        _array(input, output, **kwargs)
+        return output
+    # Let's be conservative about what we feed to the C++ code.
+    try:
+        if output.dtype.type not in _allowed_dtypes:
+            raise TypeError(
+                "The only supported numpy dtypes for output are: "
+                + ", ".join(sorted([x.__name__ for x in _allowed_dtypes]))
+                + f" not {output.dtype.name}"
+            )
+    except AttributeError:
+        if not hasattr(output, "typecode"):
+            msg = (
+                "Only numpy ndarray and array.array types for output are "
+                f"supported, not {type(output)}"
+            )
+            raise TypeError(msg) from None
 
     # Call the C++ extension
     _array(input, output, **kwargs)
-
-    # If no output value was given on calling, we return the output as a return value.
-    if return_output:
-        return output
     return None
 
 
 __all__ = [
     "ALLOWED",
+    "CLAMP",
     "DISALLOWED",
     "INPUT",
     "NUMBER_ONLY",
     "RAISE",
+    "SKIP",
     "STRING_ONLY",
+    "TypeCode",
     "__version__",
+    "all_float",
+    "all_int",
+    "any_invalid",
     "check_float",
     "check_int",
     "check_intlike",
@@ -343,6 +533,7 @@ __all__ = [
     "fast_forceint",
     "fast_int",
     "fast_real",
+    "first_invalid_index",
     "float",
     "int",
     "isfloat",
@@ -350,10 +541,12 @@ __all__ = [
     "isintlike",
     "isreal",
     "query_type",
+    "query_type_codes",
     "real",
     "try_array",
     "try_float",
     "try_forceint",
     "try_int",
     "try_real",
+    "try_scaled_int",
 ]
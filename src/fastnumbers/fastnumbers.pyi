@@ -11,7 +11,15 @@ from typing import (
 
 from typing_extensions import Protocol, TypeAlias
 
-from . import ALLOWED_T, DISALLOWED_T, INPUT_T, NUMBER_ONLY_T, RAISE_T, STRING_ONLY_T
+from . import (
+    ALLOWED_T,
+    DISALLOWED_T,
+    INPUT_T,
+    NUMBER_ONLY_T,
+    RAISE_T,
+    SKIP_T,
+    STRING_ONLY_T,
+)
 
 __version__: str
 
@@ -46,6 +54,7 @@ ConsiderType: TypeAlias = STRING_ONLY_T | NUMBER_ONLY_T | None
 InfNanCheckType: TypeAlias = STRING_ONLY_T | NUMBER_ONLY_T | ALLOWED_T | DISALLOWED_T
 TrySelectorsType: TypeAlias = ALLOWED_T | INPUT_T | RAISE_T
 FloatInt: TypeAlias = pyfloat | pyint
+BatchedCallable: TypeAlias = Callable[[list[Any]], Sequence[Any]]
 
 # Try real
 @overload
@@ -55,6 +64,7 @@ def try_real(
     inf: Any = ...,
     nan: Any = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -68,6 +78,7 @@ def try_real(
     inf: TrySelectorsType | pyfloat | Callable[[pyfloat], pyfloat] = ...,
     nan: TrySelectorsType | pyfloat | Callable[[pyfloat], pyfloat] = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: Literal[False],
     denoise: bool = ...,
@@ -81,6 +92,7 @@ def try_real(
     inf: TrySelectorsType | FloatInt | Callable[[NumInputType], FloatInt] = ...,
     nan: TrySelectorsType | FloatInt | Callable[[NumInputType], FloatInt] = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -100,6 +112,7 @@ def try_real(
     | StrInputType
     | Callable[[StrInputType], FloatInt | StrInputType] = ...,
     on_fail: INPUT_T = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -113,6 +126,7 @@ def try_real(
     inf: ALLOWED_T | RAISE_T | FloatInt | Callable[[StrInputType], FloatInt] = ...,
     nan: ALLOWED_T | RAISE_T | FloatInt | Callable[[StrInputType], FloatInt] = ...,
     on_fail: RAISE_T | FloatInt | Callable[[StrInputType], FloatInt],
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -126,6 +140,7 @@ def try_real(
     inf: Any | Callable[[NumInputType], Any] = ...,
     nan: Any | Callable[[NumInputType], Any] = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -139,6 +154,7 @@ def try_real(
     inf: Any = ...,
     nan: Any = ...,
     on_fail: Any,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -152,6 +168,7 @@ def try_real(
     inf: ALLOWED_T | RAISE_T | FloatInt | Callable[[AnyInputType], FloatInt] = ...,
     nan: ALLOWED_T | RAISE_T | FloatInt | Callable[[AnyInputType], FloatInt] = ...,
     on_fail: RAISE_T | FloatInt | Callable[[AnyInputType], FloatInt],
+    batch_on_fail: Literal[False] = ...,
     on_type_error: FloatInt | Callable[[AnyInputType], FloatInt],
     coerce: bool = ...,
     denoise: bool = ...,
@@ -165,6 +182,7 @@ def try_real(
     inf: Any = ...,
     nan: Any = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -178,6 +196,7 @@ def try_real(
     inf: Any = ...,
     nan: Any = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -191,6 +210,7 @@ def try_real(
     inf: TrySelectorsType | pyfloat | Callable[[pyfloat], pyfloat] = ...,
     nan: TrySelectorsType | pyfloat | Callable[[pyfloat], pyfloat] = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: Literal[False],
     denoise: bool = ...,
@@ -204,6 +224,7 @@ def try_real(
     inf: TrySelectorsType | FloatInt | Callable[[NumInputType], FloatInt] = ...,
     nan: TrySelectorsType | FloatInt | Callable[[NumInputType], FloatInt] = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -223,6 +244,7 @@ def try_real(
     | StrInputType
     | Callable[[StrInputType], FloatInt | StrInputType] = ...,
     on_fail: INPUT_T = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -235,7 +257,8 @@ def try_real(
     *,
     inf: ALLOWED_T | RAISE_T | FloatInt | Callable[[StrInputType], FloatInt] = ...,
     nan: ALLOWED_T | RAISE_T | FloatInt | Callable[[StrInputType], FloatInt] = ...,
-    on_fail: RAISE_T | FloatInt | Callable[[StrInputType], FloatInt],
+    on_fail: RAISE_T | SKIP_T | FloatInt | Callable[[StrInputType], FloatInt],
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -249,6 +272,7 @@ def try_real(
     inf: Any | Callable[[NumInputType], Any] = ...,
     nan: Any | Callable[[NumInputType], Any] = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -262,6 +286,7 @@ def try_real(
     inf: Any = ...,
     nan: Any = ...,
     on_fail: Any,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -274,8 +299,9 @@ def try_real(
     *,
     inf: ALLOWED_T | RAISE_T | FloatInt | Callable[[AnyInputType], FloatInt] = ...,
     nan: ALLOWED_T | RAISE_T | FloatInt | Callable[[AnyInputType], FloatInt] = ...,
-    on_fail: RAISE_T | FloatInt | Callable[[AnyInputType], FloatInt],
-    on_type_error: FloatInt | Callable[[AnyInputType], FloatInt],
+    on_fail: RAISE_T | SKIP_T | FloatInt | Callable[[AnyInputType], FloatInt],
+    batch_on_fail: Literal[False] = ...,
+    on_type_error: SKIP_T | FloatInt | Callable[[AnyInputType], FloatInt],
     coerce: bool = ...,
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -288,6 +314,7 @@ def try_real(
     inf: Any = ...,
     nan: Any = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -301,6 +328,7 @@ def try_real(
     inf: Any = ...,
     nan: Any = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -314,6 +342,7 @@ def try_real(
     inf: TrySelectorsType | pyfloat | Callable[[pyfloat], pyfloat] = ...,
     nan: TrySelectorsType | pyfloat | Callable[[pyfloat], pyfloat] = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: Literal[False],
     denoise: bool = ...,
@@ -327,6 +356,7 @@ def try_real(
     inf: TrySelectorsType | FloatInt | Callable[[NumInputType], FloatInt] = ...,
     nan: TrySelectorsType | FloatInt | Callable[[NumInputType], FloatInt] = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -346,6 +376,7 @@ def try_real(
     | StrInputType
     | Callable[[StrInputType], FloatInt | StrInputType] = ...,
     on_fail: INPUT_T = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -358,7 +389,8 @@ def try_real(
     *,
     inf: ALLOWED_T | RAISE_T | FloatInt | Callable[[StrInputType], FloatInt] = ...,
     nan: ALLOWED_T | RAISE_T | FloatInt | Callable[[StrInputType], FloatInt] = ...,
-    on_fail: RAISE_T | FloatInt | Callable[[StrInputType], FloatInt],
+    on_fail: RAISE_T | SKIP_T | FloatInt | Callable[[StrInputType], FloatInt],
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -372,6 +404,7 @@ def try_real(
     inf: Any | Callable[[NumInputType], Any] = ...,
     nan: Any | Callable[[NumInputType], Any] = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -385,6 +418,7 @@ def try_real(
     inf: Any = ...,
     nan: Any = ...,
     on_fail: Any,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     coerce: bool = ...,
     denoise: bool = ...,
@@ -397,8 +431,9 @@ def try_real(
     *,
     inf: ALLOWED_T | RAISE_T | FloatInt | Callable[[AnyInputType], FloatInt] = ...,
     nan: ALLOWED_T | RAISE_T | FloatInt | Callable[[AnyInputType], FloatInt] = ...,
-    on_fail: RAISE_T | FloatInt | Callable[[AnyInputType], FloatInt],
-    on_type_error: FloatInt | Callable[[AnyInputType], FloatInt],
+    on_fail: RAISE_T | SKIP_T | FloatInt | Callable[[AnyInputType], FloatInt],
+    batch_on_fail: Literal[False] = ...,
+    on_type_error: SKIP_T | FloatInt | Callable[[AnyInputType], FloatInt],
     coerce: bool = ...,
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -411,12 +446,27 @@ def try_real(
     inf: Any = ...,
     nan: Any = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any,
     coerce: bool = ...,
     denoise: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
 ) -> Iterator[Any]: ...
+@overload
+def try_real(
+    x: Any,
+    *,
+    inf: Any = ...,
+    nan: Any = ...,
+    on_fail: BatchedCallable,
+    batch_on_fail: Literal[True],
+    on_type_error: Any = ...,
+    coerce: bool = ...,
+    denoise: bool = ...,
+    allow_underscores: bool = ...,
+    map: bool | type[list] = ...,
+) -> Any: ...
 
 # Try float
 @overload
@@ -426,6 +476,7 @@ def try_float(
     inf: TrySelectorsType | pyfloat | Callable[[NumInputType], pyfloat] = ...,
     nan: TrySelectorsType | pyfloat | Callable[[NumInputType], pyfloat] = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
@@ -443,6 +494,7 @@ def try_float(
     | StrInputType
     | Callable[[StrInputType], pyfloat | StrInputType] = ...,
     on_fail: INPUT_T = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
@@ -454,6 +506,7 @@ def try_float(
     inf: ALLOWED_T | RAISE_T | pyfloat | Callable[[StrInputType], pyfloat] = ...,
     nan: ALLOWED_T | RAISE_T | pyfloat | Callable[[StrInputType], pyfloat] = ...,
     on_fail: RAISE_T | pyfloat | Callable[[StrInputType], pyfloat],
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
@@ -465,6 +518,7 @@ def try_float(
     inf: Any | Callable[[NumInputType], Any] = ...,
     nan: Any | Callable[[NumInputType], Any] = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
@@ -476,6 +530,7 @@ def try_float(
     inf: Any = ...,
     nan: Any = ...,
     on_fail: Any,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
@@ -487,6 +542,7 @@ def try_float(
     inf: ALLOWED_T | RAISE_T | pyfloat | Callable[[AnyInputType], pyfloat] = ...,
     nan: ALLOWED_T | RAISE_T | pyfloat | Callable[[AnyInputType], pyfloat] = ...,
     on_fail: RAISE_T | pyfloat | Callable[[AnyInputType], pyfloat],
+    batch_on_fail: Literal[False] = ...,
     on_type_error: pyfloat | Callable[[AnyInputType], pyfloat],
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
@@ -498,6 +554,7 @@ def try_float(
     inf: Any = ...,
     nan: Any = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
@@ -509,6 +566,7 @@ def try_float(
     inf: TrySelectorsType | pyfloat | Callable[[NumInputType], pyfloat] = ...,
     nan: TrySelectorsType | pyfloat | Callable[[NumInputType], pyfloat] = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: type[list],
@@ -526,6 +584,7 @@ def try_float(
     | StrInputType
     | Callable[[StrInputType], pyfloat | StrInputType] = ...,
     on_fail: INPUT_T = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: type[list],
@@ -536,7 +595,8 @@ def try_float(
     *,
     inf: ALLOWED_T | RAISE_T | pyfloat | Callable[[StrInputType], pyfloat] = ...,
     nan: ALLOWED_T | RAISE_T | pyfloat | Callable[[StrInputType], pyfloat] = ...,
-    on_fail: RAISE_T | pyfloat | Callable[[StrInputType], pyfloat],
+    on_fail: RAISE_T | SKIP_T | pyfloat | Callable[[StrInputType], pyfloat],
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: type[list],
@@ -548,6 +608,7 @@ def try_float(
     inf: Any | Callable[[NumInputType], Any] = ...,
     nan: Any | Callable[[NumInputType], Any] = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: type[list],
@@ -559,6 +620,7 @@ def try_float(
     inf: Any = ...,
     nan: Any = ...,
     on_fail: Any,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: type[list],
@@ -569,8 +631,9 @@ def try_float(
     *,
     inf: ALLOWED_T | RAISE_T | pyfloat | Callable[[AnyInputType], pyfloat] = ...,
     nan: ALLOWED_T | RAISE_T | pyfloat | Callable[[AnyInputType], pyfloat] = ...,
-    on_fail: RAISE_T | pyfloat | Callable[[AnyInputType], pyfloat],
-    on_type_error: pyfloat | Callable[[AnyInputType], pyfloat],
+    on_fail: RAISE_T | SKIP_T | pyfloat | Callable[[AnyInputType], pyfloat],
+    batch_on_fail: Literal[False] = ...,
+    on_type_error: SKIP_T | pyfloat | Callable[[AnyInputType], pyfloat],
     allow_underscores: bool = ...,
     map: type[list],
 ) -> list[pyfloat]: ...
@@ -581,6 +644,7 @@ def try_float(
     inf: Any = ...,
     nan: Any = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any,
     allow_underscores: bool = ...,
     map: type[list],
@@ -592,6 +656,7 @@ def try_float(
     inf: TrySelectorsType | pyfloat | Callable[[NumInputType], pyfloat] = ...,
     nan: TrySelectorsType | pyfloat | Callable[[NumInputType], pyfloat] = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
@@ -609,6 +674,7 @@ def try_float(
     | StrInputType
     | Callable[[StrInputType], pyfloat | StrInputType] = ...,
     on_fail: INPUT_T = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
@@ -619,7 +685,8 @@ def try_float(
     *,
     inf: ALLOWED_T | RAISE_T | pyfloat | Callable[[StrInputType], pyfloat] = ...,
     nan: ALLOWED_T | RAISE_T | pyfloat | Callable[[StrInputType], pyfloat] = ...,
-    on_fail: RAISE_T | pyfloat | Callable[[StrInputType], pyfloat],
+    on_fail: RAISE_T | SKIP_T | pyfloat | Callable[[StrInputType], pyfloat],
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
@@ -631,6 +698,7 @@ def try_float(
     inf: Any | Callable[[NumInputType], Any] = ...,
     nan: Any | Callable[[NumInputType], Any] = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
@@ -642,6 +710,7 @@ def try_float(
     inf: Any = ...,
     nan: Any = ...,
     on_fail: Any,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
@@ -652,8 +721,9 @@ def try_float(
     *,
     inf: ALLOWED_T | RAISE_T | pyfloat | Callable[[AnyInputType], pyfloat] = ...,
     nan: ALLOWED_T | RAISE_T | pyfloat | Callable[[AnyInputType], pyfloat] = ...,
-    on_fail: RAISE_T | pyfloat | Callable[[AnyInputType], pyfloat],
-    on_type_error: pyfloat | Callable[[AnyInputType], pyfloat],
+    on_fail: RAISE_T | SKIP_T | pyfloat | Callable[[AnyInputType], pyfloat],
+    batch_on_fail: Literal[False] = ...,
+    on_type_error: SKIP_T | pyfloat | Callable[[AnyInputType], pyfloat],
     allow_underscores: bool = ...,
     map: Literal[True],
 ) -> Iterator[pyfloat]: ...
@@ -664,10 +734,23 @@ def try_float(
     inf: Any = ...,
     nan: Any = ...,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any,
     allow_underscores: bool = ...,
     map: Literal[True],
 ) -> Iterator[Any]: ...
+@overload
+def try_float(
+    x: Any,
+    *,
+    inf: Any = ...,
+    nan: Any = ...,
+    on_fail: BatchedCallable,
+    batch_on_fail: Literal[True],
+    on_type_error: Any = ...,
+    allow_underscores: bool = ...,
+    map: bool | type[list] = ...,
+) -> Any: ...
 
 # Try int
 @overload
@@ -675,6 +758,7 @@ def try_int(
     x: NumInputType,
     *,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
@@ -684,6 +768,7 @@ def try_int(
     x: StrInputType,
     *,
     on_fail: INPUT_T = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
@@ -694,6 +779,7 @@ def try_int(
     x: StrInputType,
     *,
     on_fail: RAISE_T | pyint | Callable[[StrInputType], pyint],
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
@@ -704,6 +790,7 @@ def try_int(
     x: StrInputType,
     *,
     on_fail: Any,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
@@ -714,6 +801,7 @@ def try_int(
     x: AnyInputType,
     *,
     on_fail: RAISE_T | pyint | Callable[[AnyInputType], pyint],
+    batch_on_fail: Literal[False] = ...,
     on_type_error: pyint | Callable[[AnyInputType], pyint],
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
@@ -724,6 +812,7 @@ def try_int(
     x: Any,
     *,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any,
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
@@ -734,6 +823,7 @@ def try_int(
     x: Iterable[NumInputType],
     *,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: type[list],
@@ -743,6 +833,7 @@ def try_int(
     x: Iterable[StrInputType],
     *,
     on_fail: INPUT_T = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
@@ -752,7 +843,8 @@ def try_int(
 def try_int(
     x: Iterable[StrInputType],
     *,
-    on_fail: RAISE_T | pyint | Callable[[StrInputType], pyint],
+    on_fail: RAISE_T | SKIP_T | pyint | Callable[[StrInputType], pyint],
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
@@ -763,6 +855,7 @@ def try_int(
     x: Iterable[StrInputType],
     *,
     on_fail: Any,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
@@ -772,8 +865,9 @@ def try_int(
 def try_int(
     x: Iterable[AnyInputType],
     *,
-    on_fail: RAISE_T | pyint | Callable[[AnyInputType], pyint],
-    on_type_error: pyint | Callable[[AnyInputType], pyint],
+    on_fail: RAISE_T | SKIP_T | pyint | Callable[[AnyInputType], pyint],
+    batch_on_fail: Literal[False] = ...,
+    on_type_error: SKIP_T | pyint | Callable[[AnyInputType], pyint],
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: type[list],
@@ -783,6 +877,7 @@ def try_int(
     x: Iterable[Any],
     *,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any,
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
@@ -793,6 +888,7 @@ def try_int(
     x: Iterable[NumInputType],
     *,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
@@ -802,6 +898,7 @@ def try_int(
     x: Iterable[StrInputType],
     *,
     on_fail: INPUT_T = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
@@ -811,7 +908,8 @@ def try_int(
 def try_int(
     x: Iterable[StrInputType],
     *,
-    on_fail: RAISE_T | pyint | Callable[[StrInputType], pyint],
+    on_fail: RAISE_T | SKIP_T | pyint | Callable[[StrInputType], pyint],
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
@@ -822,6 +920,7 @@ def try_int(
     x: Iterable[StrInputType],
     *,
     on_fail: Any,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
@@ -831,8 +930,9 @@ def try_int(
 def try_int(
     x: Iterable[AnyInputType],
     *,
-    on_fail: RAISE_T | pyint | Callable[[AnyInputType], pyint],
-    on_type_error: pyint | Callable[[AnyInputType], pyint],
+    on_fail: RAISE_T | SKIP_T | pyint | Callable[[AnyInputType], pyint],
+    batch_on_fail: Literal[False] = ...,
+    on_type_error: SKIP_T | pyint | Callable[[AnyInputType], pyint],
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
@@ -842,11 +942,23 @@ def try_int(
     x: Iterable[Any],
     *,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any,
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
 ) -> Iterator[Any]: ...
+@overload
+def try_int(
+    x: Any,
+    *,
+    on_fail: BatchedCallable,
+    batch_on_fail: Literal[True],
+    on_type_error: Any = ...,
+    base: IntBaseType = ...,
+    allow_underscores: bool = ...,
+    map: bool | type[list] = ...,
+) -> Any: ...
 
 # Try forceint
 @overload
@@ -854,6 +966,7 @@ def try_forceint(
     x: NumInputType,
     *,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -864,6 +977,7 @@ def try_forceint(
     x: StrInputType,
     *,
     on_fail: INPUT_T = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -874,6 +988,7 @@ def try_forceint(
     x: StrInputType,
     *,
     on_fail: RAISE_T | pyint | Callable[[StrInputType], pyint],
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -884,6 +999,7 @@ def try_forceint(
     x: StrInputType,
     *,
     on_fail: Any,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -894,6 +1010,7 @@ def try_forceint(
     x: AnyInputType,
     *,
     on_fail: RAISE_T | pyint | Callable[[AnyInputType], pyint],
+    batch_on_fail: Literal[False] = ...,
     on_type_error: pyint | Callable[[AnyInputType], pyint],
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -904,6 +1021,7 @@ def try_forceint(
     x: Any,
     *,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any,
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -914,6 +1032,7 @@ def try_forceint(
     x: Iterable[NumInputType],
     *,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -924,6 +1043,7 @@ def try_forceint(
     x: Iterable[StrInputType],
     *,
     on_fail: INPUT_T = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -933,7 +1053,8 @@ def try_forceint(
 def try_forceint(
     x: Iterable[StrInputType],
     *,
-    on_fail: RAISE_T | pyint | Callable[[StrInputType], pyint],
+    on_fail: RAISE_T | SKIP_T | pyint | Callable[[StrInputType], pyint],
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -944,6 +1065,7 @@ def try_forceint(
     x: Iterable[StrInputType],
     *,
     on_fail: Any,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -953,8 +1075,9 @@ def try_forceint(
 def try_forceint(
     x: Iterable[AnyInputType],
     *,
-    on_fail: RAISE_T | pyint | Callable[[AnyInputType], pyint],
-    on_type_error: pyint | Callable[[AnyInputType], pyint],
+    on_fail: RAISE_T | SKIP_T | pyint | Callable[[AnyInputType], pyint],
+    batch_on_fail: Literal[False] = ...,
+    on_type_error: SKIP_T | pyint | Callable[[AnyInputType], pyint],
     denoise: bool = ...,
     allow_underscores: bool = ...,
     map: type[list],
@@ -964,6 +1087,7 @@ def try_forceint(
     x: Iterable[Any],
     *,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any,
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -974,6 +1098,7 @@ def try_forceint(
     x: Iterable[NumInputType],
     *,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -984,6 +1109,7 @@ def try_forceint(
     x: Iterable[StrInputType],
     *,
     on_fail: INPUT_T = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -993,7 +1119,8 @@ def try_forceint(
 def try_forceint(
     x: Iterable[StrInputType],
     *,
-    on_fail: RAISE_T | pyint | Callable[[StrInputType], pyint],
+    on_fail: RAISE_T | SKIP_T | pyint | Callable[[StrInputType], pyint],
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -1004,6 +1131,7 @@ def try_forceint(
     x: Iterable[StrInputType],
     *,
     on_fail: Any,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any = ...,
     denoise: bool = ...,
     allow_underscores: bool = ...,
@@ -1013,8 +1141,9 @@ def try_forceint(
 def try_forceint(
     x: Iterable[AnyInputType],
     *,
-    on_fail: RAISE_T | pyint | Callable[[AnyInputType], pyint],
-    on_type_error: pyint | Callable[[AnyInputType], pyint],
+    on_fail: RAISE_T | SKIP_T | pyint | Callable[[AnyInputType], pyint],
+    batch_on_fail: Literal[False] = ...,
+    on_type_error: SKIP_T | pyint | Callable[[AnyInputType], pyint],
     denoise: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
@@ -1024,11 +1153,97 @@ def try_forceint(
     x: Iterable[Any],
     *,
     on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
     on_type_error: Any,
     denoise: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
 ) -> Iterator[Any]: ...
+@overload
+def try_forceint(
+    x: Any,
+    *,
+    on_fail: BatchedCallable,
+    batch_on_fail: Literal[True],
+    on_type_error: Any = ...,
+    denoise: bool = ...,
+    allow_underscores: bool = ...,
+    map: bool | type[list] = ...,
+) -> Any: ...
+
+# Try scaled int
+@overload
+def try_scaled_int(
+    x: AnyInputType,
+    scale: HasIndex,
+    *,
+    on_fail: RAISE_T | pyint | Callable[[AnyInputType], pyint],
+    batch_on_fail: Literal[False] = ...,
+    on_overflow: RAISE_T | pyint | Callable[[AnyInputType], pyint],
+    on_type_error: RAISE_T | pyint | Callable[[AnyInputType], pyint] = ...,
+    allow_underscores: bool = ...,
+    map: Literal[False] = ...,
+) -> pyint: ...
+@overload
+def try_scaled_int(
+    x: Any,
+    scale: HasIndex,
+    *,
+    on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
+    on_overflow: Any = ...,
+    on_type_error: Any = ...,
+    allow_underscores: bool = ...,
+    map: Literal[False] = ...,
+) -> Any: ...
+@overload
+def try_scaled_int(
+    x: Iterable[Any],
+    scale: HasIndex,
+    *,
+    on_fail: RAISE_T | SKIP_T | pyint | Callable[[Any], pyint],
+    batch_on_fail: Literal[False] = ...,
+    on_overflow: RAISE_T | pyint | Callable[[Any], pyint],
+    on_type_error: RAISE_T | pyint | Callable[[Any], pyint] = ...,
+    allow_underscores: bool = ...,
+    map: type[list],
+) -> list[pyint]: ...
+@overload
+def try_scaled_int(
+    x: Iterable[Any],
+    scale: HasIndex,
+    *,
+    on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
+    on_overflow: Any = ...,
+    on_type_error: Any = ...,
+    allow_underscores: bool = ...,
+    map: type[list],
+) -> list[Any]: ...
+@overload
+def try_scaled_int(
+    x: Iterable[Any],
+    scale: HasIndex,
+    *,
+    on_fail: Any = ...,
+    batch_on_fail: Literal[False] = ...,
+    on_overflow: Any = ...,
+    on_type_error: Any = ...,
+    allow_underscores: bool = ...,
+    map: Literal[True],
+) -> Iterator[Any]: ...
+@overload
+def try_scaled_int(
+    x: Any,
+    scale: HasIndex,
+    *,
+    on_fail: BatchedCallable,
+    batch_on_fail: Literal[True],
+    on_overflow: Any = ...,
+    on_type_error: Any = ...,
+    allow_underscores: bool = ...,
+    map: bool | type[list] = ...,
+) -> Any: ...
 
 # Fast real
 @overload
@@ -1517,6 +1732,41 @@ def check_intlike(
     allow_underscores: bool = ...,
 ) -> bool: ...
 
+# Reductions
+
+def all_int(
+    input: Iterable[Any],
+    *,
+    consider: ConsiderType = ...,
+    base: IntBaseType = ...,
+    allow_underscores: bool = ...,
+) -> bool: ...
+def all_float(
+    input: Iterable[Any],
+    *,
+    consider: ConsiderType = ...,
+    inf: InfNanCheckType = ...,
+    nan: InfNanCheckType = ...,
+    strict: bool = ...,
+    allow_underscores: bool = ...,
+) -> bool: ...
+def any_invalid(
+    input: Iterable[Any],
+    *,
+    consider: ConsiderType = ...,
+    inf: InfNanCheckType = ...,
+    nan: InfNanCheckType = ...,
+    allow_underscores: bool = ...,
+) -> bool: ...
+def first_invalid_index(
+    input: Iterable[Any],
+    *,
+    consider: ConsiderType = ...,
+    inf: InfNanCheckType = ...,
+    nan: InfNanCheckType = ...,
+    allow_underscores: bool = ...,
+) -> pyint: ...
+
 # Deprecated checking
 
 def isreal(
@@ -1573,6 +1823,12 @@ def query_type(
     allowed_types: Sequence[type[Any]],
     allow_underscores: bool = ...,
 ) -> type[QueryInputType | pyint | pyfloat] | None: ...
+def query_type_codes(
+    input: Iterable[Any],
+    output: Any = ...,
+    *,
+    allow_underscores: bool = ...,
+) -> tuple[Any, tuple[pyint, ...]]: ...
 
 # Buitin replacements
 @overload
@@ -2,7 +2,8 @@ from __future__ import annotations
 
 import array
 import ctypes
-from typing import TYPE_CHECKING, Any, Callable, NoReturn, TypedDict
+import decimal
+from typing import TYPE_CHECKING, Any, Callable, Literal, NoReturn, TypedDict
 
 import numpy as np
 import pytest
@@ -146,25 +147,42 @@ def test_invalid_input_type_gives_type_error() -> None:
         fastnumbers.try_array(given, [])  # type: ignore[call-overload]
 
 
-def test_require_output_if_numpy_is_not_installed() -> None:
-    """A missing output value requires numpy to construct the output"""
-    given = [0, 1]
+@pytest.mark.parametrize("style", [list, iter])
+@pytest.mark.parametrize(
+    ("dtype", "typecode"), [(None, "d"), ("d", "d"), ("i", "i"), ("B", "B")]
+)
+def test_array_array_is_returned_if_numpy_is_not_installed(
+    style: Callable[[Any], Any], dtype: str | None, typecode: str
+) -> None:
+    """A missing output value without numpy gives an array.array"""
+    given = style(["0", 1, "2"])
     orig = fastnumbers.has_numpy
     try:
         fastnumbers.has_numpy = False
-        with pytest.raises(RuntimeError, match="To use fastnumbers"):
-            fastnumbers.try_array(given)
+        result = fastnumbers.try_array(given, dtype=dtype)  # type: ignore[call-overload]
     finally:
         fastnumbers.has_numpy = orig
+    assert isinstance(result, array.array)
+    assert result == array.array(typecode, [0, 1, 2])
 
 
-@pytest.mark.parametrize(
-    "output",
-    [np.array([[0, 0], [0, 0]]), np.array(0)],
-)
-def test_require_identically_one_ndarray_dimension(
-    output: np.ndarray[Any, np.dtype[np.int_]],
+@pytest.mark.parametrize("style", [list, iter])
+@pytest.mark.parametrize("typecode", ["z", "e", "?"])
+def test_invalid_typecode_gives_type_error(
+    style: Callable[[Any], Any], typecode: str
 ) -> None:
+    """Without numpy, only array.array typecodes can be returned"""
+    orig = fastnumbers.has_numpy
+    try:
+        fastnumbers.has_numpy = False
+        with pytest.raises(TypeError, match=f"Unknown buffer format '{typecode}'"):
+            fastnumbers.try_array(style([0, 1]), dtype=typecode)  # type: ignore[call-overload]
+    finally:
+        fastnumbers.has_numpy = orig
+
+
+def test_require_at_least_one_ndarray_dimension() -> None:
+    output = np.array(0)
     with pytest.raises(ValueError, match="Can only accept arrays of dimension 1"):
         fastnumbers.try_array([0, 9], output)
 
@@ -179,7 +197,7 @@ def test_require_input_and_output_to_have_equal_size() -> None:
 # here that exist.
 other_dtypes = [
     getattr(np, x)
-    for x in ("float128", "complex128", "half", "bool_", "bytes_", "str_")
+    for x in ("float128", "complex128", "bytes_", "str_")
     if hasattr(np, x)
 ]
 
@@ -455,6 +473,14 @@ class TestErrors:
         with pytest.raises(TypeError, match=expected):
             fastnumbers.try_array(given, result)
 
+    @pytest.mark.parametrize(
+        "param", ["on_fail", "on_overflow", "on_type_error", "inf", "nan"]
+    )
+    def test_skip_is_not_allowed(self, param: str) -> None:
+        kwargs = {param: fastnumbers.SKIP}
+        with pytest.raises(ValueError, match="SKIP is not allowed for try_array"):
+            fastnumbers.try_array(["1"], **kwargs)
+
     @pytest.mark.parametrize("data_type", data_types)
     def test_given_broken_generator_fails(self, data_type: str) -> None:
         """A generator's exception should be returned"""
@@ -678,6 +704,56 @@ class TestNumpy:
         result = fastnumbers.try_array(given)
         assert np.array_equal(result, expected, equal_nan=True)
 
+    @pytest.mark.parametrize("dtype", dtypes)
+    def test_unsized_iterable_is_streamed_into_right_sized_array(
+        self, dtype: np.dtype[np.int_] | np.dtype[np.float64]
+    ) -> None:
+        # Long enough to need the buffer to grow several times
+        given = (str(x % 100) for x in range(10000))
+        expected = np.array([x % 100 for x in range(10000)], dtype=dtype)
+        result = fastnumbers.try_array(given, dtype=dtype)
+        assert result.dtype == dtype
+        assert result.flags.writeable
+        assert np.array_equal(result, expected)
+
+    def test_sequence_without_length_is_iterated(self) -> None:
+        class GetItemOnly:
+            def __getitem__(self, index: int) -> str:
+                if index >= 3:
+                    raise IndexError(index)
+                return str(index + 4)
+
+        result = fastnumbers.try_array(GetItemOnly(), dtype=np.int32)
+        assert np.array_equal(result, np.array([4, 5, 6], dtype=np.int32))
+
+    def test_unsized_iterable_is_consumed_only_once(self) -> None:
+        consumed = []
+
+        def gen() -> Iterator[str]:
+            for x in ["4", "bad", "6"]:
+                consumed.append(x)
+                yield x
+
+        expected = np.array([4, -1, 6], dtype=np.int8)
+        result = fastnumbers.try_array(gen(), dtype=np.int8, on_fail=-1)
+        assert np.array_equal(result, expected)
+        assert consumed == ["4", "bad", "6"]
+
+    def test_empty_unsized_iterable_gives_empty_array(self) -> None:
+        result = fastnumbers.try_array(iter([]), dtype=np.int32)
+        assert result.dtype == np.int32
+        assert result.shape == (0,)
+
+    def test_unsized_iterable_with_unsupported_dtype_gives_type_error(self) -> None:
+        with pytest.raises(TypeError, match="Unknown buffer format"):
+            fastnumbers.try_array(iter(["1"]), dtype=np.dtype(">f8"))
+
+    @pytest.mark.parametrize("size", [2, 4])
+    def test_unsized_iterable_must_match_given_output_size(self, size: int) -> None:
+        given = iter([str(x) for x in range(size)])
+        with pytest.raises(ValueError, match="input/output must be of equal size"):
+            fastnumbers.try_array(given, np.zeros(3))
+
     @pytest.mark.parametrize("dtype", dtypes)
     def test_supported_dtypes(
         self, dtype: np.dtype[np.int_] | np.dtype[np.float64]
@@ -817,6 +893,1051 @@ class TestNumpy:
         assert np.array_equal(result, expected)
 
 
+class TestMultiDimensional:
+    """Nested rows are walked directly into a multi-dimensional output"""
+
+    @pytest.mark.parametrize("order", ["C", "F"])
+    def test_2d_output_is_filled_row_by_row(self, order: Literal["C", "F"]) -> None:
+        given = [["1", "2", "3"], ("4", 5.0, "⑥")]
+        result = np.zeros((2, 3), order=order)
+        expected = np.array([[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]])
+        fastnumbers.try_array(given, result)
+        assert np.array_equal(result, expected)
+
+    def test_3d_output_accepts_any_nested_iterable(self) -> None:
+        given = (((1, "2"), ["3", 4]), iter([["5", 6], (str(x) for x in (7, 8))]))
+        result = np.zeros((2, 2, 2), dtype=np.int32)
+        expected = np.arange(1, 9, dtype=np.int32).reshape(2, 2, 2)
+        fastnumbers.try_array(given, result)
+        assert np.array_equal(result, expected)
+
+    def test_strided_2d_output(self) -> None:
+        given = [["1", "2"], ["3", "4"]]
+        result = np.zeros((4, 4), dtype=np.int64)
+        expected = np.array(
+            [[1, 0, 2, 0], [0, 0, 0, 0], [3, 0, 4, 0], [0, 0, 0, 0]], dtype=np.int64
+        )
+        fastnumbers.try_array(given, result[::2, ::2])
+        assert np.array_equal(result, expected)
+
+    def test_per_cell_replacements_apply(self) -> None:
+        given = [["inf", "nan"], ["bad", None]]
+        result = np.zeros((2, 2))
+        expected = np.array([[1.0, 2.0], [3.0, 4.0]])
+        fastnumbers.try_array(
+            given, result, inf=1.0, nan=2.0, on_fail=3.0, on_type_error=4.0
+        )
+        assert np.array_equal(result, expected)
+
+    @pytest.mark.parametrize(
+        "given",
+        [
+            [["1", "2", "3"]],
+            [["1", "2", "3"], ["4", "5", "6"], ["7", "8", "9"]],
+            [["1", "2"], ["4", "5"]],
+            [["1", "2", "3"], ["4", "5", "6", "7"]],
+        ],
+    )
+    def test_shape_mismatch_gives_value_error(self, given: list[list[str]]) -> None:
+        result = np.zeros((2, 3))
+        with pytest.raises(ValueError, match="input/output must be of equal size"):
+            fastnumbers.try_array(given, result)
+
+    def test_string_rows_give_type_error(self) -> None:
+        result = np.zeros((2, 3))
+        with pytest.raises(TypeError, match="expected a nested iterable"):
+            fastnumbers.try_array(["123", "456"], result)
+
+    def test_non_iterable_rows_give_type_error(self) -> None:
+        result = np.zeros((2, 3))
+        with pytest.raises(TypeError, match="'int' object is not iterable"):
+            fastnumbers.try_array([1, 2], result)
+
+
+class TestHalfAndBool:
+    """Types without an array.array typecode are supported too"""
+
+    @pytest.mark.parametrize("style", [list, iter])
+    def test_float16_rounds_to_nearest_even(self, style: Callable[[Any], Any]) -> None:
+        # Halfway cases round to even, just above halfway rounds up,
+        # and too small or too large gives zero or infinity
+        given = ["1.0", "2049", 2051, "2049.0000001", "1e-8", "-1e-10", "70000", 0.1]
+        expected = np.array(
+            [1.0, 2048, 2052, 2050, 1e-8, -0.0, np.inf, 0.1], dtype=np.float16
+        )
+        result = fastnumbers.try_array(style(given), dtype=np.float16)
+        assert result.dtype == np.float16
+        assert np.array_equal(result, expected)
+        assert np.signbit(result[5])
+
+    def test_float16_text_is_rounded_once(self) -> None:
+        # Each of these is closer to a half than its nearest double is, and
+        # that double lies exactly halfway between two halves
+        given = [
+            "1.00048828125000000001",
+            "-1.00048828124999999999e0",
+            "65519.999999999999999",
+            "2.98023223876953125000_1e-8",
+            "2049.0000000000000000001",
+        ]
+        expected = np.array([1.0009765625, -1.0, 65504, 2**-24, 2050], dtype=np.float16)
+        result = fastnumbers.try_array(given, dtype=np.float16, allow_underscores=True)
+        assert np.array_equal(result, expected)
+
+    def test_float16_matches_numpy_casting(self) -> None:
+        given = np.random.default_rng(0).standard_normal(1000) * 10.0 ** np.arange(
+            -10, 10, 0.02
+        )
+        with np.errstate(over="ignore"):
+            expected = given.astype(np.float16)
+        result = fastnumbers.try_array(list(given), dtype=np.float16)
+        assert np.array_equal(result, expected, equal_nan=True)
+
+    def test_float16_nan_and_inf_replacement(self) -> None:
+        given = ["nan", "-inf", "1e5", "5"]
+        result = np.zeros(4, dtype=np.float16)
+        expected = np.array([1, 2, 2, 5], dtype=np.float16)
+        fastnumbers.try_array(given, result, nan=1, inf=2)
+        assert np.array_equal(result, expected)
+
+    @pytest.mark.parametrize("style", [list, iter])
+    def test_bool_accepts_zero_and_one(self, style: Callable[[Any], Any]) -> None:
+        given = ["0", 1, True, False, "1"]
+        expected = np.array([False, True, True, False, True])
+        result = fastnumbers.try_array(style(given), dtype=np.bool_)
+        assert result.dtype == np.bool_
+        assert np.array_equal(result, expected)
+
+    @pytest.mark.parametrize("value", ["2", -1, "-1", 255, 256])
+    def test_bool_overflows_outside_zero_and_one(self, value: Any) -> None:
+        output = np.zeros(1, dtype=np.bool_)
+        msg = "Cannot convert .* to C type 'bool' without overflowing"
+        with pytest.raises(OverflowError, match=msg):
+            fastnumbers.try_array([value], output)
+        fastnumbers.try_array([value], output, on_overflow=True)
+        assert output[0]
+
+    def test_bool_invalid_replacement_is_rejected(self) -> None:
+        output = np.zeros(1, dtype=np.bool_)
+        with pytest.raises(OverflowError, match="to C type 'bool' without"):
+            fastnumbers.try_array(["bad"], output, on_fail=2)
+
+
+class TestScale:
+    """Fixed-point decimals are stored as scaled integers"""
+
+    @pytest.mark.parametrize("style", [list, iter])
+    def test_decimals_are_scaled_exactly(self, style: Callable[[Any], Any]) -> None:
+        given = ["12.34", "-0.01", "1e2", 5, 0.1, "٣.٥", "1_0.5"]
+        expected = np.array([1234, -1, 10000, 500, 10, 350, 1050], dtype=np.int64)
+        result = fastnumbers.try_array(
+            style(given), dtype=np.int64, scale=2, allow_underscores=True
+        )
+        assert result.dtype == np.int64
+        assert np.array_equal(result, expected)
+
+    def test_negative_scale(self) -> None:
+        result = np.zeros(3, dtype=np.int32)
+        fastnumbers.try_array(["1200", 3400, "5.6e3"], result, scale=-2)
+        assert np.array_equal(result, np.array([12, 34, 56], dtype=np.int32))
+
+    @pytest.mark.parametrize("value", [10**20, -(10**20) - 100])
+    def test_negative_scale_of_big_int_matches_str(self, value: int) -> None:
+        # Too big for the dtype before it is scaled, but not after
+        given = [value, str(value)]
+        result = fastnumbers.try_array(given, dtype=np.int64, scale=-2, on_overflow=-1)
+        assert np.array_equal(result, np.array([value // 100] * 2, dtype=np.int64))
+
+    def test_zero_scale_allows_exact_decimals(self) -> None:
+        result = fastnumbers.try_array(["12.00", "1.2e1"], dtype=np.int8, scale=0)
+        assert np.array_equal(result, np.array([12, 12], dtype=np.int8))
+
+    def test_lost_digits_are_a_failure(self) -> None:
+        with pytest.raises(ValueError, match="Cannot convert '12.345'"):
+            fastnumbers.try_array(["12.345"], dtype=np.int64, scale=2)
+        given = ["12.345", 1.001]
+        result = fastnumbers.try_array(given, dtype=np.int64, scale=2, on_fail=-1)
+        assert np.array_equal(result, np.array([-1, -1], dtype=np.int64))
+
+    @pytest.mark.parametrize(
+        ("dtype", "value"),
+        [(np.int8, "1.28"), (np.int8, "-1.29"), (np.uint8, "-0.01"), (np.int64, 1e17)],
+    )
+    def test_out_of_range_is_an_overflow(self, dtype: Any, value: Any) -> None:
+        with pytest.raises(OverflowError, match="without overflowing"):
+            fastnumbers.try_array([value], dtype=dtype, scale=2)
+        result = fastnumbers.try_array([value], dtype=dtype, scale=2, on_overflow=7)
+        assert result[0] == 7
+
+    def test_extremes_fit(self) -> None:
+        given = ["-1.28", "1.27"]
+        result = fastnumbers.try_array(given, dtype=np.int8, scale=2)
+        assert np.array_equal(result, np.array([-128, 127], dtype=np.int8))
+
+    def test_replacements_are_not_scaled(self) -> None:
+        given = ["bad", None]
+        result = fastnumbers.try_array(
+            given, dtype=np.int64, scale=2, on_fail=3, on_type_error=lambda _: 4
+        )
+        assert np.array_equal(result, np.array([3, 4], dtype=np.int64))
+
+    @pytest.mark.parametrize("dtype", [np.float64, np.float16, np.bool_])
+    def test_non_integral_dtype_is_rejected(self, dtype: Any) -> None:
+        with pytest.raises(TypeError, match="scale is only supported for integer"):
+            fastnumbers.try_array(["1"], dtype=dtype, scale=2)
+
+    def test_none_is_no_scale(self) -> None:
+        with pytest.raises(ValueError, match="Cannot convert '1.5'"):
+            fastnumbers.try_array(["1.5"], dtype=np.int64, scale=None)
+
+
+class TestFloatToInt:
+    """Floats are written into integer outputs only when asked to"""
+
+    given = ["3.0", "1e3", "2.7", "-2.7", "2.5", "-3.5", 2.7, -2.5, "⅞", "7"]
+
+    @pytest.mark.parametrize(
+        ("mode", "expected"),
+        [
+            ("truncate", [3, 1000, 2, -2, 2, -3, 2, -2, 0, 7]),
+            ("round", [3, 1000, 3, -3, 2, -4, 3, -2, 1, 7]),
+            ("intlike", [3, 1000, -9, -9, -9, -9, -9, -9, -9, 7]),
+            ("raise", [-9, -9, -9, -9, -9, -9, -9, -9, -9, 7]),
+        ],
+    )
+    @pytest.mark.parametrize("style", [list, iter])
+    def test_modes(
+        self, mode: str, expected: list[int], style: Callable[[Any], Any]
+    ) -> None:
+        result = fastnumbers.try_array(
+            style(self.given), dtype=np.int32, float_to_int=mode, on_fail=-9
+        )
+        assert np.array_equal(result, np.array(expected, dtype=np.int32))
+
+    def test_default_treats_floats_as_invalid(self) -> None:
+        with pytest.raises(ValueError, match="Cannot convert '3.0'"):
+            fastnumbers.try_array(["3.0"], dtype=np.int32)
+
+    @pytest.mark.parametrize(
+        ("value", "expected"),
+        [
+            ("2.5000000000000000001", 3),
+            ("0.5", 0),
+            ("1.5", 2),
+            ("5e-1", 0),
+            ("5.1e-1", 1),
+            ("5e-2", 0),
+            ("9.5e-1", 1),
+            ("12345678901234567.5", 12345678901234568),
+            ("-9223372036854775808.4", -9223372036854775808),
+            ("1_2.5", 12),
+        ],
+    )
+    def test_strings_round_exactly_from_their_digits(
+        self, value: str, expected: int
+    ) -> None:
+        result = fastnumbers.try_array(
+            [value], dtype=np.int64, float_to_int="round", allow_underscores=True
+        )
+        assert result[0] == expected
+
+    @pytest.mark.parametrize("mode", ["truncate", "round", "intlike"])
+    def test_nan_and_inf_are_invalid(self, mode: str) -> None:
+        given = ["nan", "inf", float("nan"), float("-inf")]
+        result = fastnumbers.try_array(
+            given, dtype=np.int64, float_to_int=mode, on_fail=-1
+        )
+        assert np.array_equal(result, np.full(4, -1, dtype=np.int64))
+
+    @pytest.mark.parametrize(
+        ("dtype", "value"),
+        [
+            (np.int8, "127.5"),
+            (np.int8, -128.6),
+            (np.int64, "9223372036854775807.5"),
+            (np.int64, 9.3e18),
+            (np.uint8, "-0.6"),
+            (np.uint64, 1.9e19),
+        ],
+    )
+    def test_out_of_range_is_an_overflow(self, dtype: Any, value: Any) -> None:
+        with pytest.raises(OverflowError, match="without overflowing"):
+            fastnumbers.try_array([value], dtype=dtype, float_to_int="round")
+        result = fastnumbers.try_array(
+            [value], dtype=dtype, float_to_int="round", on_overflow=7
+        )
+        assert result[0] == 7
+
+    def test_negative_floats_may_round_to_unsigned_zero(self) -> None:
+        given = ["-0.4", -0.4, "-0.0"]
+        result = fastnumbers.try_array(given, dtype=np.uint8, float_to_int="round")
+        assert np.array_equal(result, np.zeros(3, dtype=np.uint8))
+
+    def test_bool_output(self) -> None:
+        given = ["0.4", 0.6, "1.0", "-0.2"]
+        result = fastnumbers.try_array(given, dtype=np.bool_, float_to_int="round")
+        assert np.array_equal(result, np.array([False, True, True, False]))
+
+    @pytest.mark.parametrize("dtype", [np.float64, np.float32, np.float16])
+    def test_non_integral_dtype_is_rejected(self, dtype: Any) -> None:
+        with pytest.raises(TypeError, match="float_to_int is only supported for int"):
+            fastnumbers.try_array(["1.5"], dtype=dtype, float_to_int="round")
+        result = fastnumbers.try_array(["1.5"], dtype=dtype, float_to_int="raise")
+        assert result[0] == 1.5
+
+    @pytest.mark.parametrize("mode", ["floor", "", None, 1])
+    def test_invalid_mode(self, mode: Any) -> None:
+        with pytest.raises(ValueError, match="allowed values for 'float_to_int'"):
+            fastnumbers.try_array(["1"], dtype=np.int64, float_to_int=mode)
+
+    def test_cannot_be_combined_with_scale(self) -> None:
+        with pytest.raises(ValueError, match="scale and float_to_int"):
+            fastnumbers.try_array(["1"], dtype=np.int64, scale=2, float_to_int="round")
+
+
+class TestClamp:
+    """Overflows saturate to the limits of the dtype with CLAMP"""
+
+    @pytest.mark.parametrize("style", [list, iter])
+    def test_strings_and_ints(self, style: Callable[[Any], Any]) -> None:
+        given = ["300", "-300", "5", 300, -300, 10**30, -(10**30), "-0"]
+        result = fastnumbers.try_array(
+            style(given), dtype=np.int8, on_overflow=fastnumbers.CLAMP
+        )
+        expected = np.array([127, -128, 5, 127, -128, 127, -128, 0], dtype=np.int8)
+        assert np.array_equal(result, expected)
+
+    def test_other_numeric_types(self) -> None:
+        given = [decimal.Decimal("-1e40"), np.int64(1000), np.int64(-1000), 300.7]
+        result = fastnumbers.try_array(
+            given,
+            dtype=np.int8,
+            on_overflow=fastnumbers.CLAMP,
+            float_to_int="truncate",
+        )
+        assert np.array_equal(result, np.array([-128, 127, -128, 127], dtype=np.int8))
+
+    @pytest.mark.parametrize(
+        ("given", "expected"),
+        [("1e30", 2**63 - 1), ("-1e30", -(2**63)), (-2e30, -(2**63))],
+    )
+    def test_floats(self, given: Any, expected: int) -> None:
+        result = fastnumbers.try_array(
+            [given], dtype=np.int64, on_overflow=fastnumbers.CLAMP, float_to_int="round"
+        )
+        assert result[0] == expected
+
+    def test_unsigned_negative_is_zero(self) -> None:
+        given = ["-3", -5, -(10**30), "7", 1000]
+        result = fastnumbers.try_array(
+            given, dtype=np.uint8, on_overflow=fastnumbers.CLAMP
+        )
+        assert np.array_equal(result, np.array([0, 0, 0, 7, 255], dtype=np.uint8))
+
+    def test_bool_output(self) -> None:
+        result = fastnumbers.try_array(
+            ["3", "-3", "0"], dtype=np.bool_, on_overflow=fastnumbers.CLAMP
+        )
+        assert np.array_equal(result, np.array([True, False, False]))
+
+    def test_failures_are_still_failures(self) -> None:
+        result = fastnumbers.try_array(
+            ["300", "x"], dtype=np.int8, on_overflow=fastnumbers.CLAMP, on_fail=-1
+        )
+        assert np.array_equal(result, np.array([127, -1], dtype=np.int8))
+
+    @pytest.mark.parametrize("param", ["on_fail", "on_type_error", "inf", "nan"])
+    def test_only_allowed_for_on_overflow(self, param: str) -> None:
+        kwargs = {param: fastnumbers.CLAMP}
+        with pytest.raises(ValueError, match="only allowed for 'on_overflow'"):
+            fastnumbers.try_array(["1"], **kwargs)
+
+    def test_not_allowed_for_scalar_functions(self) -> None:
+        with pytest.raises(ValueError, match="only supported for 'on_overflow'"):
+            fastnumbers.try_scaled_int("1", 2, on_overflow=fastnumbers.CLAMP)
+
+    @hyp_given(lists(integers(), max_size=50))
+    @pytest.mark.parametrize("dtype", int_dtypes)
+    def test_matches_clipping(self, dtype: Any, x: list[int]) -> None:
+        low, high = dtype_extremes[dtype]
+        expected = np.array([min(max(v, low), high) for v in x], dtype=dtype)
+        result = fastnumbers.try_array(x, dtype=dtype, on_overflow=fastnumbers.CLAMP)
+        assert np.array_equal(result, expected)
+
+
+class TestMask:
+    """Elements that were not converted are flagged in the mask"""
+
+    given = ["5", "bad", None, "1e999", "nan", float("nan"), 7, "inf"]
+    kwargs: KwargsType = {"on_fail": 0, "on_type_error": 0, "on_overflow": 0}
+
+    @pytest.mark.parametrize("style", [list, tuple, iter])
+    def test_float_output(self, style: Callable[[Any], Any]) -> None:
+        mask = np.ones(len(self.given), dtype=np.bool_)
+        output = np.empty(len(self.given))
+        fastnumbers.try_array(style(self.given), output, mask=mask, **self.kwargs)
+        expected = [False, True, True, False, True, True, False, False]
+        assert np.array_equal(mask, np.array(expected))
+
+    @pytest.mark.parametrize("style", [list, iter])
+    def test_int_output(self, style: Callable[[Any], Any]) -> None:
+        mask = np.zeros(len(self.given), dtype=np.uint8)
+        result = fastnumbers.try_array(
+            style(self.given), dtype=np.int8, mask=mask, **self.kwargs
+        )
+        assert np.array_equal(result, np.array([5, 0, 0, 0, 0, 0, 7, 0]))
+        assert np.array_equal(mask, np.array([0, 1, 1, 1, 1, 1, 0, 1]))
+
+    def test_flags_are_kept_with_replacements(self) -> None:
+        mask = bytearray(4)
+        result = fastnumbers.try_array(
+            ["300", "-300", "5", "nan"],
+            dtype=np.int8,
+            on_overflow=fastnumbers.CLAMP,
+            on_fail=lambda _: 1,
+            mask=mask,
+        )
+        assert np.array_equal(result, np.array([127, -128, 5, 1]))
+        assert list(mask) == [1, 1, 0, 1]
+
+    @pytest.mark.parametrize("size", [1, 7, 8, 9, 20])
+    def test_packed_bitmap(self, size: int) -> None:
+        given = ["x" if i % 3 == 0 else str(i) for i in range(size)]
+        mask = np.full((size + 7) // 8, 0xFF, dtype=np.uint8)
+        fastnumbers.try_array(given, np.empty(size), on_fail=0, mask=mask)
+        unpacked = np.unpackbits(mask, count=size, bitorder="little")
+        assert np.array_equal(unpacked, np.array([i % 3 == 0 for i in range(size)]))
+
+    def test_multi_dimensional(self) -> None:
+        output = np.empty((3, 2), order="F")
+        mask = np.empty((3, 2), dtype=np.bool_)
+        given = [["1", "x"], ["nan", "2"], ["3", "4"]]
+        fastnumbers.try_array(given, output, on_fail=0, mask=mask)
+        expected = np.array([[False, True], [True, False], [False, False]])
+        assert np.array_equal(mask, expected)
+
+    def test_array_array(self) -> None:
+        mask = array.array("B", [0, 0])
+        output = array.array("d", [0.0, 0.0])
+        fastnumbers.try_array(["x", "1"], output, on_fail=0, mask=mask)
+        assert list(mask) == [1, 0]
+
+    def test_errors_are_still_raised(self) -> None:
+        with pytest.raises(ValueError, match="Cannot convert 'x'"):
+            fastnumbers.try_array(["x"], mask=np.empty(1, dtype=np.bool_))
+
+    @pytest.mark.parametrize("size", [0, 3, 11])
+    def test_size_mismatch(self, size: int) -> None:
+        with pytest.raises(ValueError, match="one byte or one bit per element"):
+            fastnumbers.try_array(
+                [str(i) for i in range(12)], mask=np.empty(size, dtype=np.bool_)
+            )
+
+    @pytest.mark.parametrize("dtype", [np.int32, np.float64, np.int8])
+    def test_invalid_format(self, dtype: Any) -> None:
+        with pytest.raises(TypeError, match="Buffer format for the mask"):
+            fastnumbers.try_array(["1"], mask=np.empty(1, dtype=dtype))
+
+    @pytest.mark.parametrize("packed", [False, True])
+    def test_unsized_input_is_streamed(self, packed: bool) -> None:
+        size = 3000  # More than one chunk
+        given = ["x" if i % 3 == 0 else str(i) for i in range(size)]
+        mask = np.zeros((size + 7) // 8 if packed else size, dtype=np.uint8)
+        result = fastnumbers.fastnumbers.array(iter(given), on_fail=0, mask=mask)
+        assert isinstance(result, array.array)
+        assert list(result) == [0 if i % 3 == 0 else i for i in range(size)]
+        if packed:
+            mask = np.unpackbits(mask, count=size, bitorder="little")
+        assert np.array_equal(mask, np.array([i % 3 == 0 for i in range(size)]))
+
+    @pytest.mark.parametrize("size", [0, 3, 11])
+    def test_size_mismatch_when_streamed(self, size: int) -> None:
+        with pytest.raises(ValueError, match="one byte or one bit per element"):
+            fastnumbers.try_array(
+                (str(i) for i in range(12)), mask=np.empty(size, dtype=np.bool_)
+            )
+
+
+class TestBatchedOnFail:
+    """A batched on_fail callable is given every failing input at once"""
+
+    @pytest.mark.parametrize("style", [list, tuple, iter])
+    def test_callable_called_once(self, style: Callable[[Any], Any]) -> None:
+        calls: list[list[Any]] = []
+
+        def fixer(x: list[Any]) -> list[int]:
+            calls.append(x)
+            return [len(y) for y in x]
+
+        given = ["5", "bad", "7", "worse"]
+        result = fastnumbers.try_array(
+            style(given), dtype=np.int16, on_fail=fixer, batch_on_fail=True
+        )
+        assert np.array_equal(result, np.array([5, 3, 7, 5]))
+        assert calls == [["bad", "worse"]]
+
+    def test_callable_called_in_chunks(self) -> None:
+        sizes: list[int] = []
+
+        def fixer(x: list[Any]) -> list[float]:
+            sizes.append(len(x))
+            return [-1.0] * len(x)
+
+        given = ["x" if i % 2 else str(i) for i in range(5000)]
+        result = fastnumbers.try_array(given, on_fail=fixer, batch_on_fail=True)
+        expected = np.array([-1.0 if i % 2 else i for i in range(5000)])
+        assert np.array_equal(result, expected)
+        assert sizes == [1024, 1024, 452]
+
+    def test_multi_dimensional_with_mask(self) -> None:
+        output = np.empty((2, 2), dtype=np.int32)
+        mask = np.zeros((2, 2), dtype=np.bool_)
+        given = [["1", "x"], ["yy", "2"]]
+        fastnumbers.try_array(
+            given,
+            output,
+            on_fail=lambda x: [len(y) for y in x],
+            batch_on_fail=True,
+            mask=mask,
+        )
+        assert np.array_equal(output, np.array([[1, 1], [2, 2]]))
+        assert np.array_equal(mask, np.array([[False, True], [True, False]]))
+
+    def test_replacements_are_range_checked(self) -> None:
+        with pytest.raises(OverflowError, match="input .x. returned the value 300"):
+            fastnumbers.try_array(
+                ["x"], dtype=np.int8, on_fail=lambda _: [300], batch_on_fail=True
+            )
+
+    def test_length_mismatch_raises(self) -> None:
+        with pytest.raises(ValueError, match="returned 1 replacements for 2 inputs"):
+            fastnumbers.try_array(
+                ["x", "y"], on_fail=lambda _: [1.0], batch_on_fail=True
+            )
+
+
+class ArrowSchema(ctypes.Structure):
+    """The ArrowSchema structure of the Arrow C data interface"""
+
+    _fields_ = [
+        ("format", ctypes.c_char_p),
+        ("name", ctypes.c_char_p),
+        ("metadata", ctypes.c_char_p),
+        ("flags", ctypes.c_int64),
+        ("n_children", ctypes.c_int64),
+        ("children", ctypes.c_void_p),
+        ("dictionary", ctypes.c_void_p),
+        ("release", ctypes.c_void_p),
+        ("private_data", ctypes.c_void_p),
+    ]
+
+
+class ArrowArray(ctypes.Structure):
+    """The ArrowArray structure of the Arrow C data interface"""
+
+    _fields_ = [
+        ("length", ctypes.c_int64),
+        ("null_count", ctypes.c_int64),
+        ("offset", ctypes.c_int64),
+        ("n_buffers", ctypes.c_int64),
+        ("n_children", ctypes.c_int64),
+        ("buffers", ctypes.POINTER(ctypes.c_void_p)),
+        ("children", ctypes.c_void_p),
+        ("dictionary", ctypes.c_void_p),
+        ("release", ctypes.c_void_p),
+        ("private_data", ctypes.c_void_p),
+    ]
+
+
+ReleaseSchema = ctypes.CFUNCTYPE(None, ctypes.POINTER(ArrowSchema))
+ReleaseArray = ctypes.CFUNCTYPE(None, ctypes.POINTER(ArrowArray))
+PyCapsule_New = ctypes.pythonapi.PyCapsule_New
+PyCapsule_New.restype = ctypes.py_object
+PyCapsule_New.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.c_void_p]
+
+
+class ArrowStrings:
+    """
+    A minimal producer of an Arrow string array through the PyCapsule
+    interface, so that no Arrow library is needed for testing.
+    """
+
+    def __init__(
+        self, values: list[str | None], fmt: bytes = b"u", offset: int = 0
+    ) -> None:
+        self.values = values
+        self.released = 0
+        self.fmt = fmt
+        self.offset = offset
+        offsets = [0]
+        validity = bytearray((len(values) + 7) // 8)
+        encoded = b""
+        for i, value in enumerate(values):
+            if value is not None:
+                encoded += value.encode()
+                validity[i // 8] |= 1 << (i % 8)
+            offsets.append(len(encoded))
+        offset_type = ctypes.c_int64 if fmt == b"U" else ctypes.c_int32
+        self.buffers = [
+            (ctypes.c_uint8 * len(validity)).from_buffer_copy(validity),
+            (offset_type * len(offsets))(*offsets),
+            ctypes.create_string_buffer(encoded),
+        ]
+        self.null_count = values.count(None)
+        self.release_schema = ReleaseSchema(self._release_schema)
+        self.release_array = ReleaseArray(self._release_array)
+
+    def _release_schema(self, schema: Any) -> None:
+        schema.contents.release = None
+
+    def _release_array(self, arr: Any) -> None:
+        arr.contents.release = None
+        self.released += 1
+
+    def __iter__(self) -> Iterator[str | None]:
+        return iter(self.values[self.offset :])
+
+    def __arrow_c_array__(self, requested_schema: Any = None) -> tuple[Any, Any]:
+        self.schema = ArrowSchema(
+            format=self.fmt,
+            flags=2,
+            release=ctypes.cast(self.release_schema, ctypes.c_void_p),
+        )
+        self.pointers = (ctypes.c_void_p * 3)(
+            *[ctypes.addressof(x) for x in self.buffers]
+        )
+        self.array = ArrowArray(
+            length=len(self.values) - self.offset,
+            null_count=self.null_count,
+            offset=self.offset,
+            n_buffers=3,
+            buffers=self.pointers,
+            release=ctypes.cast(self.release_array, ctypes.c_void_p),
+        )
+        return (
+            PyCapsule_New(ctypes.addressof(self.schema), b"arrow_schema", None),
+            PyCapsule_New(ctypes.addressof(self.array), b"arrow_array", None),
+        )
+
+
+class TestArrow:
+    """Arrow string arrays are read directly from their buffers"""
+
+    given = ["1", None, "x", "2.5", " 7 ", "\u0663", "nan", "1e3"]
+    expected = [1.0, -2.0, -1.0, 2.5, 7.0, 3.0, float("nan"), 1000.0]
+
+    @pytest.mark.parametrize("fmt", [b"u", b"U"])
+    def test_string_and_large_string(self, fmt: bytes) -> None:
+        given = ArrowStrings(self.given, fmt)
+        result = fastnumbers.try_array(given, on_fail=-1.0, on_type_error=-2.0)
+        assert np.array_equal(result, np.array(self.expected), equal_nan=True)
+        assert given.released == 1
+
+    def test_offset_is_honored(self) -> None:
+        given = ArrowStrings(self.given, offset=3)
+        result = fastnumbers.try_array(given, on_fail=-1.0)
+        assert np.array_equal(result, np.array(self.expected[3:]), equal_nan=True)
+
+    @pytest.mark.parametrize("dtype", [np.int16, np.float16, np.bool_, "i"])
+    def test_all_output_types(self, dtype: Any) -> None:
+        given = ArrowStrings(["1", "0", None])
+        result = fastnumbers.try_array(given, dtype=dtype, on_type_error=1)
+        assert list(result) == [1, 0, 1]
+
+    def test_nulls_are_type_errors(self) -> None:
+        with pytest.raises(TypeError, match="The value None has type 'NoneType'"):
+            fastnumbers.try_array(ArrowStrings(["1", None]))
+        mask = np.zeros(3, dtype=np.bool_)
+        result = fastnumbers.try_array(
+            ArrowStrings(["1", None, "300"]),
+            dtype=np.int8,
+            on_type_error=lambda x: 5 if x is None else 6,
+            on_overflow=fastnumbers.CLAMP,
+            mask=mask,
+        )
+        assert list(result) == [1, 5, 127]
+        assert list(mask) == [False, True, True]
+
+    def test_batched_on_fail(self) -> None:
+        result = fastnumbers.try_array(
+            ArrowStrings(["x", "1", "yy"]),
+            on_fail=lambda x: [len(y) for y in x],
+            batch_on_fail=True,
+        )
+        assert list(result) == [1.0, 1.0, 2.0]
+
+    def test_given_output(self) -> None:
+        output = array.array("d", [0.0, 0.0])
+        fastnumbers.try_array(ArrowStrings(["4", "5"]), output)
+        assert list(output) == [4.0, 5.0]
+        with pytest.raises(ValueError, match="input/output must be of equal size"):
+            fastnumbers.try_array(ArrowStrings(["4"]), output)
+
+    def test_checks_and_queries_match_a_list(self) -> None:
+        given = ArrowStrings(self.given)
+        assert fastnumbers.all_float(given) is False
+        assert fastnumbers.first_invalid_index(given) == 1
+        assert fastnumbers.all_float(ArrowStrings(["1", "\u0663"])) is True
+        codes, counts = fastnumbers.query_type_codes(given)
+        assert (codes, counts) == fastnumbers.query_type_codes(self.given)
+
+    def test_other_arrow_types_are_iterated(self) -> None:
+        given = ArrowStrings(["4", "5"], fmt=b"l")
+        assert list(fastnumbers.try_array(given)) == [4.0, 5.0]
+        assert given.released == 0  # left for the capsule to release
+
+
+class TestCategories:
+    """Dictionary-encoded input converts each distinct category once"""
+
+    categories = ["1.5", "bad", "7", "nan"]
+    codes = [2, 0, 0, -1, 2, 1, 3]
+    expected = [7.0, 1.5, 1.5, -2.0, 7.0, -1.0, float("nan")]
+
+    @pytest.mark.parametrize(
+        "style",
+        [
+            list,
+            tuple,
+            iter,
+            lambda x: np.array(x, dtype=np.int8),
+            lambda x: np.array(x, dtype=np.int64),
+            lambda x: np.repeat(np.array(x, dtype=np.int32), 2)[::2],
+        ],
+    )
+    def test_codes(self, style: Callable[[Any], Any]) -> None:
+        result = fastnumbers.try_array(
+            style(self.codes),
+            categories=self.categories,
+            on_fail=-1.0,
+            on_type_error=-2.0,
+        )
+        assert np.array_equal(result, np.array(self.expected), equal_nan=True)
+
+    @pytest.mark.parametrize("categories", [categories, tuple(categories)])
+    def test_categories_sequence(self, categories: Any) -> None:
+        result = fastnumbers.try_array(
+            [3, 2, 0], categories=categories, dtype=np.float32
+        )
+        assert np.array_equal(result, np.array([np.nan, 7, 1.5]), equal_nan=True)
+
+    def test_arrow_categories(self) -> None:
+        categories = ArrowStrings(["4", None, "x"], offset=0)
+        result = fastnumbers.try_array(
+            [2, 1, 0, 2], categories=categories, on_fail=-1, on_type_error=-2
+        )
+        assert list(result) == [-1.0, -2.0, 4.0, -1.0]
+        assert categories.released == 1
+
+    def test_callables_are_called_once_per_category(self) -> None:
+        seen: list[Any] = []
+
+        def on_fail(x: Any) -> float:
+            seen.append(x)
+            return 0.0
+
+        codes = [1, 0, 1, 1, 2, 1]
+        result = fastnumbers.try_array(
+            codes, categories=["5", "bad", "worse"], on_fail=on_fail
+        )
+        assert list(result) == [0.0, 5.0, 0.0, 0.0, 0.0, 0.0]
+        assert seen == ["bad", "worse"]
+
+    def test_batched_on_fail(self) -> None:
+        result = fastnumbers.try_array(
+            [1, 0, 1, 2],
+            categories=["5", "bad", "worse"],
+            on_fail=lambda x: [len(y) for y in x],
+            batch_on_fail=True,
+        )
+        assert list(result) == [3.0, 5.0, 3.0, 5.0]
+
+    def test_unused_categories_are_not_converted(self) -> None:
+        result = fastnumbers.try_array([0, 0], categories=["1", "bad"], dtype="i")
+        assert list(result) == [1, 1]
+        with pytest.raises(ValueError, match="Cannot convert 'bad' to C type"):
+            fastnumbers.try_array([0, 1], categories=["1", "bad"], dtype="i")
+
+    def test_mask_and_given_output(self) -> None:
+        output = np.empty(len(self.codes), dtype=np.int8)
+        mask = np.ones(len(self.codes), dtype=np.bool_)
+        fastnumbers.try_array(
+            self.codes,
+            output,
+            categories=["300", "x", "7", "nan"],
+            on_fail=-1,
+            on_overflow=fastnumbers.CLAMP,
+            on_type_error=-2,
+            mask=mask,
+        )
+        assert list(output) == [7, 127, 127, -2, 7, -1, -1]
+        assert list(mask) == [False, True, True, True, False, True, True]
+
+    def test_given_output_size_mismatch(self) -> None:
+        output = np.empty(3)
+        with pytest.raises(ValueError, match="input/output must be of equal size"):
+            fastnumbers.try_array([0, 0], output, categories=["1"])
+        with pytest.raises(ValueError, match="input/output must be of equal size"):
+            fastnumbers.try_array([0, 0, 0, 0], output, categories=["1"])
+
+    @pytest.mark.parametrize("code", [-2, 3, 2**70, -(2**70), np.uint64(2**64 - 1)])
+    def test_out_of_range_codes(self, code: Any) -> None:
+        codes = np.array([0, code], dtype=np.uint64) if code == 2**64 - 1 else [0, code]
+        message = f"category code {int(code)} is out of range for 3 categories"
+        with pytest.raises(ValueError, match=message):
+            fastnumbers.try_array(codes, categories=["1", "2", "3"])
+
+    @pytest.mark.parametrize(
+        ("codes", "categories", "message"),
+        [
+            ([0.0], ["1"], "'float' object cannot be interpreted as an integer"),
+            (np.array([0.0]), ["1"], "codes must be integers, not buffer of format"),
+            (np.array([True]), ["1"], "codes must be integers, not buffer of format"),
+            ([0], "1", "categories must be a sequence of strings, not 'str'"),
+            ([0], 5, "categories must be a sequence"),
+        ],
+    )
+    def test_invalid_input(self, codes: Any, categories: Any, message: str) -> None:
+        with pytest.raises(TypeError, match=message):
+            fastnumbers.try_array(codes, categories=categories)
+
+    def test_multi_dimensional_codes(self) -> None:
+        with pytest.raises(ValueError, match="codes must be one-dimensional"):
+            fastnumbers.try_array(np.zeros((2, 2), dtype=np.int64), categories=["1"])
+
+
+class TestObjectArrays:
+    """Arrays of dtype=object are read through their buffer of pointers"""
+
+    given = ["5", 3, None, "bad", 2.5, "nan"]
+    expected = [5.0, 3.0, -2.0, -1.0, 2.5, float("nan")]
+
+    @pytest.mark.parametrize(
+        "style",
+        [
+            lambda x: np.array(x, dtype=object),
+            lambda x: np.repeat(np.array(x, dtype=object), 3)[::3],
+            lambda x: np.array(x, dtype=object)[::-1][::-1],
+        ],
+    )
+    def test_try_array(self, style: Callable[[Any], Any]) -> None:
+        result = fastnumbers.try_array(
+            style(self.given), on_fail=-1.0, on_type_error=-2.0
+        )
+        assert np.array_equal(result, np.array(self.expected), equal_nan=True)
+
+    @pytest.mark.parametrize("map_", [list, True])
+    def test_map(self, map_: Any) -> None:
+        given = np.repeat(np.array(self.given, dtype=object), 2)[::2]
+        result = fastnumbers.try_float(
+            given, on_fail=-1.0, on_type_error=-2.0, map=map_
+        )
+        assert np.array_equal(list(result), self.expected, equal_nan=True)
+
+    def test_multi_dimensional(self) -> None:
+        given = np.array([["1", 2], [None, "4"]], dtype=object)
+        output = np.empty((2, 2))
+        fastnumbers.try_array(given, output, on_type_error=0.0)
+        assert output.tolist() == [[1.0, 2.0], [0.0, 4.0]]
+        assert fastnumbers.try_int(given.T[0], map=list, on_type_error=0) == [1, 0]
+
+    def test_other_buffers_are_iterated(self) -> None:
+        assert fastnumbers.try_float(np.array([1, 2]), map=list) == [1.0, 2.0]
+        assert fastnumbers.try_int(memoryview(b"ab"), map=list) == [97, 98]
+
+
+StringDType = getattr(getattr(np, "dtypes", None), "StringDType", None)
+
+
+@pytest.mark.skipif(StringDType is None, reason="requires numpy 2.0 or later")
+class TestStringDType:
+    """numpy StringDType arrays are read without creating a str per element"""
+
+    given = ["1", None, "x", "2.5", " 7 ", "٣", "nan", "1e3", "9" * 30]
+    expected = [1.0, -2.0, -1.0, 2.5, 7.0, 3.0, float("nan"), 1000.0, float("9" * 30)]
+
+    def make(self, given: list[Any]) -> Any:
+        assert StringDType is not None
+        return np.array(given, dtype=StringDType(na_object=None))
+
+    def test_strings(self) -> None:
+        result = fastnumbers.try_array(
+            self.make(self.given), on_fail=-1.0, on_type_error=-2.0
+        )
+        assert np.array_equal(result, np.array(self.expected), equal_nan=True)
+
+    def test_strided(self) -> None:
+        given = self.make(self.given)[::-2]
+        result = fastnumbers.try_array(given, on_fail=-1.0, on_type_error=-2.0)
+        expected = np.array(self.expected[::-2])
+        assert np.array_equal(result, expected, equal_nan=True)
+
+    @pytest.mark.parametrize("dtype", [np.int16, np.float16, np.bool_, "i"])
+    def test_all_output_types(self, dtype: Any) -> None:
+        given = self.make(["1", "0", None])
+        result = fastnumbers.try_array(given, dtype=dtype, on_type_error=1)
+        assert list(result) == [1, 0, 1]
+
+    def test_given_output_and_mask(self) -> None:
+        output = np.empty(3, dtype=np.int8)
+        mask = np.zeros(3, dtype=np.bool_)
+        given = self.make(["300", "x", "5"])
+        fastnumbers.try_array(
+            given, output, on_fail=0, on_overflow=fastnumbers.CLAMP, mask=mask
+        )
+        assert list(output) == [127, 0, 5]
+        assert list(mask) == [True, True, False]
+
+    def test_callable_may_read_the_array(self) -> None:
+        given = self.make(["1", "x", "2"])
+        result = fastnumbers.try_array(given, on_fail=lambda x: len(given[0] + x))
+        assert list(result) == [1.0, 2.0, 2.0]
+
+    def test_batched_on_fail(self) -> None:
+        result = fastnumbers.try_array(
+            self.make(["x", "1", "yy"]),
+            on_fail=lambda x: [len(y) for y in x],
+            batch_on_fail=True,
+        )
+        assert list(result) == [1.0, 1.0, 2.0]
+
+    def test_longer_than_a_chunk(self) -> None:
+        strings = [str(i) for i in range(1000)]
+        strings[300] = "x"
+        strings[700] = None
+        given = self.make(strings)
+        result = fastnumbers.try_array(
+            given, on_fail=lambda x: len(given[299]) + len(x), on_type_error=-2
+        )
+        expected = [float(i) for i in range(1000)]
+        expected[300] = 4.0
+        expected[700] = -2.0
+        assert list(result) == expected
+
+    def test_checks_and_queries_match_a_list(self) -> None:
+        given = self.make(self.given)
+        assert fastnumbers.all_float(given) is False
+        assert fastnumbers.first_invalid_index(given) == 1
+        assert fastnumbers.all_float(self.make(["1", "٣"])) is True
+        codes, counts = fastnumbers.query_type_codes(given)
+        assert (codes, counts) == fastnumbers.query_type_codes(self.given)
+
+    def test_first_invalid_index_past_a_chunk(self) -> None:
+        strings = ["1.5"] * 1000
+        strings[600] = "x"
+        assert fastnumbers.first_invalid_index(self.make(strings)) == 600
+        assert fastnumbers.first_invalid_index(self.make(strings[:600])) == -1
+
+    def test_multi_dimensional(self) -> None:
+        given = self.make(["1", "2", "3", "4"]).reshape(2, 2)
+        output = np.empty((2, 2))
+        fastnumbers.try_array(given, output)
+        assert output.tolist() == [[1.0, 2.0], [3.0, 4.0]]
+
+
+class TestNumericBuffers:
+    """Buffers of numbers are cast directly, as the Python numbers they hold"""
+
+    out_dtypes: list[Any] = [*dtypes, np.float16, np.bool_]
+
+    @hyp_given(lists(integers(min_value=-(2**63), max_value=2**63 - 1), max_size=50))
+    @pytest.mark.parametrize("in_dtype", [np.int64, np.uint64])
+    @pytest.mark.parametrize("dtype", out_dtypes)
+    def test_ints_match_python_ints(
+        self, dtype: Any, in_dtype: Any, x: list[int]
+    ) -> None:
+        given = np.array(x, dtype=np.int64).astype(in_dtype)
+        kwargs: dict[str, Any] = {"on_overflow": lambda y: 1 if y > 0 else 0}
+        result = fastnumbers.try_array(given, dtype=dtype, **kwargs)
+        expected = fastnumbers.try_array(given.tolist(), dtype=dtype, **kwargs)
+        assert np.array_equal(result, expected)
+
+    @hyp_given(lists(floats(), max_size=50))
+    @pytest.mark.parametrize(
+        ("dtype", "float_to_int"),
+        [
+            *[
+                (dtype, mode)
+                for dtype in [np.int8, np.uint16, np.int64, np.uint64, np.bool_]
+                for mode in ["raise", "truncate", "round", "intlike"]
+            ],
+            *[(dtype, None) for dtype in [np.float16, np.float32, np.float64]],
+        ],
+    )
+    @pytest.mark.filterwarnings("ignore:overflow encountered in cast")
+    def test_floats_match_python_floats(
+        self, dtype: Any, float_to_int: str | None, x: list[float]
+    ) -> None:
+        given = np.array(x, dtype=np.float64)
+        kwargs: dict[str, Any] = {"on_fail": 0, "on_overflow": 1}
+        if float_to_int is not None:
+            kwargs["float_to_int"] = float_to_int
+        else:
+            kwargs.update(inf=5.0, nan=6.0)
+        result = fastnumbers.try_array(given, dtype=dtype, **kwargs)
+        expected = fastnumbers.try_array(given.tolist(), dtype=dtype, **kwargs)
+        assert np.array_equal(result, expected, equal_nan=True)
+
+    @pytest.mark.parametrize(
+        "given",
+        [
+            np.arange(600, dtype=np.int16)[::-3],
+            np.arange(600, dtype=np.float32)[::2],
+            array.array("b", range(-100, 100)),
+            array.array("Q", range(300)),
+        ],
+    )
+    def test_strided_and_array_inputs(self, given: Any) -> None:
+        kwargs: dict[str, Any] = {"on_overflow": -1, "float_to_int": "truncate"}
+        result = fastnumbers.try_array(given, dtype=np.int8, **kwargs)
+        expected = fastnumbers.try_array(
+            np.asarray(given).tolist(), dtype=np.int8, **kwargs
+        )
+        assert np.array_equal(result, expected)
+
+    def test_replacements_receive_python_numbers(self) -> None:
+        seen: list[Any] = []
+
+        def on_overflow(x: Any) -> int:
+            seen.append(x)
+            return 0
+
+        given = np.array([1, 300, 2, -300], dtype=np.int64)
+        result = fastnumbers.try_array(given, dtype=np.int8, on_overflow=on_overflow)
+        assert list(result) == [1, 0, 2, 0]
+        assert seen == [300, -300]
+        assert all(type(x) is int for x in seen)
+
+    def test_mask_and_errors(self) -> None:
+        mask = np.zeros(4, dtype=np.bool_)
+        output = np.empty(4, dtype=np.int8)
+        given = np.array([1.0, np.nan, 2.5, 1e10])
+        fastnumbers.try_array(
+            given,
+            output,
+            float_to_int="truncate",
+            on_fail=-1,
+            on_overflow=fastnumbers.CLAMP,
+            mask=mask,
+        )
+        assert list(output) == [1, -1, 2, 127]
+        assert list(mask) == [False, True, False, True]
+        with pytest.raises(OverflowError, match="300"):
+            fastnumbers.try_array(np.array([300]), dtype=np.int8)
+        with pytest.raises(ValueError, match="input/output must be of equal size"):
+            fastnumbers.try_array(np.array([1, 2]), np.empty(3))
+
+    def test_batched_on_fail(self) -> None:
+        result = fastnumbers.try_array(
+            np.array([1.5, 2.0, np.inf] * 300),
+            dtype=np.int64,
+            float_to_int="intlike",
+            on_fail=lambda x: [-1] * len(x),
+            batch_on_fail=True,
+        )
+        assert list(result) == [-1, 2, -1] * 300
+
+
 @hyp_given(
     lists(
         floats() | integers() | text() | binary() | lists(integers(), max_size=1),
@@ -924,3 +2045,88 @@ def test_sanity() -> None:
     fastnumbers.try_array([0, 1], dtype=np.uint64)
     fastnumbers.try_array([0, 1], dtype=np.float32)
     fastnumbers.try_array([0, 1], dtype=np.float64)
+
+
+class TestExactInts:
+    """Exact Python ints are read directly, subclasses through the parser"""
+
+    class IntSubclass(int):
+        pass
+
+    @pytest.mark.parametrize("dtype", [*dtypes, np.float16, np.bool_])
+    def test_matches_int_subclasses(self, dtype: Any) -> None:
+        given = [
+            0,
+            1,
+            -1,
+            2**15,
+            2**30 - 1,
+            2**30,
+            -(2**31),
+            2**53 + 1,
+            2**63 - 1,
+            -(2**63),
+            2**63,
+            2**64,
+            -(2**80),
+            True,
+        ]
+        kwargs: dict[str, Any] = {"on_overflow": lambda y: 1 if y > 0 else 0}
+        result = fastnumbers.try_array(given, dtype=dtype, **kwargs)
+        subclassed = [self.IntSubclass(x) for x in given]
+        expected = fastnumbers.try_array(subclassed, dtype=dtype, **kwargs)
+        assert np.array_equal(result, expected)
+
+    def test_scaled_and_errors(self) -> None:
+        result = fastnumbers.try_array([1, 2, 3], dtype=np.int32, scale=1)
+        assert list(result) == [10, 20, 30]
+        with pytest.raises(OverflowError, match="128"):
+            fastnumbers.try_array([127, 128], dtype=np.int8)
+
+
+class TestNumpyScalars:
+    """numpy integers and float32 scalars are read like the number they hold"""
+
+    @pytest.mark.parametrize("scalar_type", [*int_dtypes, np.intc, np.longlong])
+    def test_integers_are_ints(self, scalar_type: Any) -> None:
+        low, high = dtype_extremes.get(scalar_type, dtype_extremes[np.int32])
+        for value in [low, 0, high]:
+            scalar = scalar_type(value)
+            assert fastnumbers.query_type(scalar) is int
+            assert fastnumbers.check_int(scalar)
+            assert not fastnumbers.check_float(scalar)
+            assert fastnumbers.try_int(scalar) == value
+            assert type(fastnumbers.try_int(scalar)) is int
+            assert fastnumbers.try_real(scalar, coerce=False) == value
+            assert fastnumbers.try_float(scalar) == float(value)
+
+    @pytest.mark.parametrize("value", [1.5, -2.0, 3e38, float("inf"), float("nan")])
+    def test_float32_is_float(self, value: float) -> None:
+        scalar = np.float32(value)
+        assert fastnumbers.query_type(scalar) is float
+        expected = float(scalar)
+        result = fastnumbers.try_float(scalar)
+        assert type(result) is float
+        assert np.array_equal(result, expected, equal_nan=True)
+        assert fastnumbers.check_float(scalar) is fastnumbers.check_float(expected)
+        assert fastnumbers.check_intlike(scalar) is fastnumbers.check_intlike(expected)
+
+    @pytest.mark.parametrize("in_dtype", [np.int8, np.uint64, np.int64, np.float32])
+    @pytest.mark.parametrize("dtype", [np.int8, np.uint32, np.int64, np.float64])
+    def test_try_array_matches_buffer(self, in_dtype: Any, dtype: Any) -> None:
+        given = np.array([0, 1, 100, 127], dtype=in_dtype)
+        kwargs: dict[str, Any] = {"on_fail": 0}
+        if np.issubdtype(dtype, np.integer):
+            kwargs["float_to_int"] = "truncate"
+        result = fastnumbers.try_array(list(given), dtype=dtype, **kwargs)
+        expected = fastnumbers.try_array(given, dtype=dtype, **kwargs)
+        assert np.array_equal(result, expected)
+
+    def test_overflow(self) -> None:
+        given = [np.int64(300), np.uint64(2**64 - 1), np.int64(-1)]
+        result = fastnumbers.try_array(
+            given, dtype=np.uint8, on_overflow=fastnumbers.CLAMP
+        )
+        assert list(result) == [255, 255, 0]
+        with pytest.raises(OverflowError):
+            fastnumbers.try_array([np.int64(-1)], dtype=np.uint64)
@@ -1,10 +1,15 @@
 from __future__ import annotations
 
 import decimal
+import fractions
 import math
+import mmap
 import random
 import re
+import sys
+import threading
 import unicodedata
+from concurrent.futures import ThreadPoolExecutor
 from functools import partial
 from itertools import combinations
 from typing import (
@@ -503,6 +508,19 @@ class TestArguments:
         with pytest.raises(TypeError, match=msg):
             fastnumbers.float("5", "4")  # type: ignore[call-arg]
 
+    def test_default_options_are_not_affected_by_other_calls(self) -> None:
+        # Calls with only the input use a cached default configuration,
+        # which must be unaffected by calls using non-default options.
+        assert fastnumbers.try_float("bad") == "bad"
+        assert fastnumbers.try_float("bad", on_fail=5.0) == 5.0
+        assert fastnumbers.try_float("bad") == "bad"
+        assert fastnumbers.try_int("ff", base=16) == 255
+        assert fastnumbers.try_int("ff") == "ff"
+        assert fastnumbers.check_float("nan", nan=fastnumbers.ALLOWED)
+        assert not fastnumbers.check_float("nan")
+        assert fastnumbers.query_type("5", allowed_types=(float,)) is None
+        assert fastnumbers.query_type("5") is int
+
 
 class TestSelectors:
     """Ensure that the mode selectors behave as expected"""
@@ -514,6 +532,8 @@ class TestSelectors:
         fastnumbers.RAISE,
         fastnumbers.STRING_ONLY,
         fastnumbers.NUMBER_ONLY,
+        fastnumbers.CLAMP,
+        fastnumbers.SKIP,
     ]
 
     @parametrize("x", selectors)
@@ -1409,6 +1429,126 @@ class TestTryForceInt:
         assert result == expected
 
 
+class TestTryScaledInt:
+    """
+    Tests for the try_scaled_int function, which is not part of the generalized tests.
+    """
+
+    @given(
+        integers(min_value=-(10**20), max_value=10**20),
+        integers(min_value=-30, max_value=30),
+        integers(min_value=-20, max_value=20),
+    )
+    @example(9223372036854775807, 0, 0)
+    @example(-9223372036854775808, 0, 0)
+    @example(9223372036854775808, 0, 0)
+    @example(-9223372036854775809, 0, 0)
+    @example(-922337203685477580800, -2, 0)
+    @example(1234500, -5, 2)
+    def test_given_decimal_string_returns_exactly_scaled_int(
+        self, digits: int, exponent: int, scale: int
+    ) -> None:
+        x = str(decimal.Decimal(digits).scaleb(exponent))
+        value = fractions.Fraction(digits) * fractions.Fraction(10) ** (
+            exponent + scale
+        )
+        if value.denominator != 1:
+            expected: Any = "fail"
+        elif not -(2**63) <= value.numerator < 2**63:
+            expected = "overflow"
+        else:
+            expected = value.numerator
+        kwargs = {"on_fail": "fail", "on_overflow": "overflow"}
+        result = fastnumbers.try_scaled_int(x, scale, **kwargs)
+        assert result == expected
+        assert fastnumbers.try_scaled_int(pad(x), scale, **kwargs) == result
+
+    @parametrize(
+        ("x", "scale", "expected"),
+        [
+            ("12.34", 2, 1234),
+            ("-0.01", 2, -1),
+            ("+5", 2, 500),
+            ("5.", 1, 50),
+            (".5", 1, 5),
+            ("1.5e3", 2, 150000),
+            ("1.5E-1", 2, 15),
+            ("1200", -2, 12),
+            ("12.3400", 2, 1234),
+            ("-0.000", 2, 0),
+            (b"1.25", 2, 125),
+            (bytearray(b"1.25"), 2, 125),
+            ("٣.٥", 1, 35),
+            ("⑦", 2, 700),
+        ],
+    )
+    def test_given_valid_text_returns_scaled_int(
+        self, x: str | bytes | bytearray, scale: int, expected: int
+    ) -> None:
+        result = fastnumbers.try_scaled_int(x, scale)
+        assert result == expected
+        assert isinstance(result, int)
+
+    @parametrize(
+        ("x", "scale", "expected"),
+        [
+            (12, 2, 1200),
+            (True, 2, 100),
+            (-1200, -2, -12),
+            (0.1, 2, 10),
+            (1.005, 3, 1005),
+            (-2.5e-3, 4, -25),
+            (decimal.Decimal("12.34"), 2, 1234),
+            (decimal.Decimal("1.2E+3"), 0, 1200),
+        ],
+    )
+    def test_given_number_returns_scaled_int_from_repr(
+        self, x: Any, scale: int, expected: int
+    ) -> None:
+        assert fastnumbers.try_scaled_int(x, scale) == expected
+
+    @parametrize(
+        "x",
+        ["12.345", "1201", "1e-3", "nan", "inf", "", "1.2.3", "٣.٥٥٥", 1.001, 1201],
+    )
+    def test_given_inexact_or_invalid_input_fails(self, x: Any) -> None:
+        scale = -2 if isinstance(x, int) or x == "1201" else 2
+        assert fastnumbers.try_scaled_int(x, scale) is x
+        assert fastnumbers.try_scaled_int(x, scale, on_fail=-1) == -1
+        with pytest.raises(ValueError, match="could not convert .* with scale"):
+            fastnumbers.try_scaled_int(x, scale, on_fail=fastnumbers.RAISE)
+
+    @parametrize("x", ["1e30", "-92233720368547758.09", 10**20, 1e300, "1"])
+    def test_given_too_large_input_overflows(self, x: Any) -> None:
+        scale = 10**6 if x == "1" else 2
+        assert fastnumbers.try_scaled_int(x, scale) is x
+        assert fastnumbers.try_scaled_int(x, scale, on_overflow=-1) == -1
+        assert fastnumbers.try_scaled_int(x, scale, on_fail=-2) is x
+        with pytest.raises(OverflowError, match="does not fit in a signed 64-bit"):
+            fastnumbers.try_scaled_int(x, scale, on_overflow=fastnumbers.RAISE)
+
+    def test_underscores_are_optional(self) -> None:
+        assert fastnumbers.try_scaled_int("1_0.5", 1) == "1_0.5"
+        assert fastnumbers.try_scaled_int("1_0.5", 1, allow_underscores=True) == 105
+
+    def test_type_error(self) -> None:
+        with pytest.raises(TypeError, match="not 'list'"):
+            fastnumbers.try_scaled_int([1], 2)
+        assert fastnumbers.try_scaled_int([1], 2, on_type_error=5) == 5
+
+    @parametrize("scale", [None, "2", 2.0])
+    def test_scale_must_be_an_integer(self, scale: Any) -> None:
+        with pytest.raises(TypeError):
+            fastnumbers.try_scaled_int("1", scale)
+
+    def test_map(self) -> None:
+        given = ["1.1", "2.25", "bad", "3.333"]
+        expected = [110, 225, 0, 0]
+        assert fastnumbers.try_scaled_int(given, 2, on_fail=0, map=list) == expected
+        result = fastnumbers.try_scaled_int(iter(given), 2, on_fail=0, map=True)
+        assert list(result) == expected
+
+
 class TestCheckingFunctions:
     """
     Test the successful execution of the "checking" functions, e.g.:
@@ -1859,6 +1999,138 @@ class TestQueryType:
         assert fastnumbers.query_type(x, allowed_types=(float, int, str)) is None
 
 
+class TestReductions:
+    """Tests for the all_int, all_float, any_invalid, and first_invalid_index."""
+
+    @given(lists(floats() | integers() | text(max_size=10), max_size=50))
+    def test_reductions_agree_with_check_functions(
+        self, x: list[float | int | str]
+    ) -> None:
+        assert fastnumbers.all_int(x) == all(fastnumbers.check_int(y) for y in x)
+        assert fastnumbers.all_float(x) == all(fastnumbers.check_float(y) for y in x)
+        is_real = [fastnumbers.check_real(y) for y in x]
+        assert fastnumbers.any_invalid(x) == (not all(is_real))
+        expected = is_real.index(False) if False in is_real else -1
+        assert fastnumbers.first_invalid_index(x) == expected
+        # Non-sequence iterables take a different code path
+        assert fastnumbers.first_invalid_index(iter(x)) == expected
+
+    def test_first_invalid_index_spanning_ascii_batches(self) -> None:
+        x = ["1"] * 1000 + ["\u2167", "1.5"] * 300 + ["bad", "1"]
+        assert fastnumbers.first_invalid_index(x) == 1600
+        assert fastnumbers.first_invalid_index(tuple(x)) == 1600
+        assert fastnumbers.any_invalid(x)
+        assert not fastnumbers.any_invalid(x[:1600])
+
+    def test_reductions_stop_at_first_failure(self) -> None:
+        def gen() -> Iterator[str]:
+            yield "1"
+            yield "x"
+            msg = "Should not be reached"
+            raise AssertionError(msg)
+
+        assert not fastnumbers.all_int(gen())
+        assert not fastnumbers.all_float(gen())
+        assert fastnumbers.any_invalid(gen())
+        assert fastnumbers.first_invalid_index(gen()) == 1
+
+    def test_empty_input(self) -> None:
+        assert fastnumbers.all_int([])
+        assert fastnumbers.all_float([])
+        assert not fastnumbers.any_invalid([])
+        assert fastnumbers.first_invalid_index([]) == -1
+
+    def test_options_are_respected(self) -> None:
+        assert fastnumbers.all_int(["ff", "10"], base=16)
+        assert not fastnumbers.all_int(["1", 2], consider=fastnumbers.STRING_ONLY)
+        assert not fastnumbers.all_int(["1", 2], consider=fastnumbers.NUMBER_ONLY)
+        assert not fastnumbers.all_float(["1.5", "2"], strict=True)
+        assert not fastnumbers.all_float(["1.5", "nan"])
+        assert fastnumbers.all_float(["1.5", "nan"], nan=fastnumbers.ALLOWED)
+        assert fastnumbers.first_invalid_index(["1", "inf"]) == 1
+        inf = fastnumbers.ALLOWED
+        assert fastnumbers.first_invalid_index(["1", "inf"], inf=inf) == -1
+        assert fastnumbers.first_invalid_index(["1_0"]) == 0
+        assert fastnumbers.first_invalid_index(["1_0"], allow_underscores=True) == -1
+
+    def test_raises_type_error_on_non_iterable(self) -> None:
+        with pytest.raises(TypeError, match="'int' object is not iterable"):
+            fastnumbers.all_int(5)  # type: ignore[arg-type]
+
+
+class TestQueryTypeCodes:
+    """Tests for the query_type_codes function."""
+
+    def test_codes_and_counts_for_mixed_input(self) -> None:
+        x = ["56", "56.07", "56.0", "nan", "-inf", "bad", None, 5, 5.5, 5.0]
+        codes, counts = fastnumbers.query_type_codes(x)
+        TC = fastnumbers.TypeCode
+        expected = [
+            TC.INT,
+            TC.FLOAT,
+            TC.INTLIKE,
+            TC.NAN,
+            TC.INF,
+            TC.INVALID,
+            TC.OTHER,
+            TC.INT,
+            TC.FLOAT,
+            TC.INTLIKE,
+        ]
+        assert isinstance(codes, bytearray)
+        assert list(codes) == expected
+        assert counts == (2, 2, 2, 1, 1, 1, 1)
+
+    @given(lists(floats() | integers() | text(max_size=50), max_size=50))
+    def test_codes_agree_with_query_type(self, x: list[float | int | str]) -> None:
+        codes, counts = fastnumbers.query_type_codes(x)
+        assert len(codes) == len(x)
+        assert sum(counts) == len(x)
+        assert all(counts[code] == list(codes).count(code) for code in range(7))
+        for value, code in zip(x, codes):
+            expected = fastnumbers.query_type(value, allow_inf=True, allow_nan=True)
+            if code in (fastnumbers.TypeCode.INVALID, fastnumbers.TypeCode.OTHER):
+                assert expected is type(value)
+            elif code == fastnumbers.TypeCode.INT:
+                assert expected is int
+            else:
+                assert expected is float
+
+    @parametrize(
+        "iterable_gen",
+        [list, tuple, iter, lambda x: (y for y in x)],
+    )
+    def test_handles_any_iterable(
+        self, iterable_gen: Callable[[Any], Iterable[Any]]
+    ) -> None:
+        codes, counts = fastnumbers.query_type_codes(iterable_gen(["1", "x"]))
+        assert list(codes) == [fastnumbers.TypeCode.INT, fastnumbers.TypeCode.INVALID]
+        assert counts == (1, 0, 0, 0, 0, 1, 0)
+
+    def test_populates_given_output(self) -> None:
+        output = bytearray(3)
+        result, counts = fastnumbers.query_type_codes(["1", "1.5", "x"], output)
+        assert result is output
+        assert list(output) == [0, 1, 5]
+        assert counts == (1, 1, 0, 0, 0, 1, 0)
+
+    def test_allow_underscores(self) -> None:
+        codes, _ = fastnumbers.query_type_codes(["1_0"])
+        assert list(codes) == [fastnumbers.TypeCode.INVALID]
+        codes, _ = fastnumbers.query_type_codes(["1_0"], allow_underscores=True)
+        assert list(codes) == [fastnumbers.TypeCode.INT]
+
+    def test_output_must_be_uint8(self) -> None:
+        from array import array
+
+        with pytest.raises(TypeError, match="must be 'B'"):
+            fastnumbers.query_type_codes(["1"], array("d", [0.0]))
+
+    def test_output_must_be_same_size_as_input(self) -> None:
+        with pytest.raises(ValueError, match="input/output must be of equal size"):
+            fastnumbers.query_type_codes(["1"], bytearray(2))
+
+
 class TestMappingFunctions:
     """Ensure that mapping functions operate on iterables"""
 
@@ -1917,6 +2189,27 @@ class TestMappingFunctions:
         mapping = capture_result(mapper, x)
         assert nonmapping == mapping
 
+    @parametrize(
+        "nomapper, mapper",
+        [
+            (fastnumbers.try_real, partial(fastnumbers.try_real, map=list)),
+            (fastnumbers.try_int, partial(fastnumbers.try_int, map=list)),
+        ],
+    )
+    def test_mapping_non_mapping_behave_the_same_as_types_change(
+        self, nomapper: ConversionFuncs, mapper: ConversionFuncs
+    ) -> None:
+        class FloatStr(str):
+            def __float__(self) -> float:
+                return 4.5
+
+        # Runs of one type, broken up by every other kind of input
+        x: list[Any] = ["7", "8", "\u0664\u0662", "9", b"10", b"11", bytearray(b"12")]
+        x += [memoryview(b"13"), 14, 15.0, FloatStr("16"), "x", "17", "18"]
+        nonmapping = capture_result(lambda y: list(map(nomapper, y)), x)
+        mapping = capture_result(mapper, x)
+        assert nonmapping == mapping
+
     @parametrize(
         "func",
         [
@@ -2100,3 +2393,302 @@ class TestMappingFunctions:
         expected = [5]
         result = list(func(style([("Fëanor",)]), on_type_error=5))
         assert result == expected
+
+    def test_iterator_shared_between_threads_yields_each_element_once(self) -> None:
+        n = 10000
+        result = fastnumbers.try_int([str(i) for i in range(n)], map=True)
+        collected: list[list[int]] = [[] for _ in range(4)]
+
+        def consume(out: list[int]) -> None:
+            out.extend(result)
+
+        with ThreadPoolExecutor(max_workers=len(collected)) as pool:
+            list(pool.map(consume, collected))
+        assert sorted(x for out in collected for x in out) == list(range(n))
+
+
+
+class TestSkip:
+    """Elements are left out of the result with SKIP"""
+
+    funcs = conversion_funcs
+
+    @parametrize("func", get_funcs(funcs), ids=funcs)
+    @parametrize("style", [list, iter, lambda x: (y for y in x)])
+    @parametrize("map_", [True, list])
+    def test_failures_are_dropped(
+        self, func: ConversionFuncs, style: Callable[[Any], Any], map_: Any
+    ) -> None:
+        given = ["x", "1", "bad", "bad", "2", "3", "bad"]
+        result = func(style(given), on_fail=fastnumbers.SKIP, map=map_)
+        assert list(result) == [1, 2, 3]
+
+    @parametrize("map_", [True, list])
+    def test_every_element_can_be_dropped(self, map_: Any) -> None:
+        result = fastnumbers.try_int(["x"] * 100, on_fail=fastnumbers.SKIP, map=map_)
+        assert list(result) == []
+
+    def test_type_errors_inf_and_nan_can_be_dropped(self) -> None:
+        result = fastnumbers.try_float(
+            ["1", None, "inf", "nan", "2"],
+            on_type_error=fastnumbers.SKIP,
+            inf=fastnumbers.SKIP,
+            nan=fastnumbers.SKIP,
+            map=list,
+        )
+        assert result == [1.0, 2.0]
+
+    def test_works_with_batched_on_fail(self) -> None:
+        result = fastnumbers.try_int(
+            ["x", None, "y", "2"],
+            on_fail=lambda x: [len(y) for y in x],
+            batch_on_fail=True,
+            on_type_error=fastnumbers.SKIP,
+            map=list,
+        )
+        assert result == [1, 1, 2]
+
+    @parametrize("style", [list, iter, lambda x: (y for y in x)])
+    @parametrize("map_", [True, list])
+    def test_batched_on_fail_can_return_skip(
+        self, style: Callable[[Any], Any], map_: Any
+    ) -> None:
+        given = ["x", "1", "bad", "2", "y"] * 1000
+
+        def replace(failed: list[str]) -> list[Any]:
+            return [fastnumbers.SKIP if x != "bad" else -1 for x in failed]
+
+        result = fastnumbers.try_int(
+            style(given), on_fail=replace, batch_on_fail=True, map=map_
+        )
+        assert list(result) == [1, -1, 2] * 1000
+
+    funcs = conversion_funcs + ["fast_real", "fast_float", "fast_int", "fast_forceint"]
+
+    @parametrize("func", get_funcs(funcs), ids=funcs)
+    def test_not_allowed_without_map(self, func: Callable[..., Any]) -> None:
+        with pytest.raises(ValueError, match="only allowed when map is True or list"):
+            func("x", on_fail=fastnumbers.SKIP)
+
+    @parametrize("func", get_funcs(funcs), ids=funcs)
+    def test_not_allowed_from_callable_without_map(
+        self, func: Callable[..., Any]
+    ) -> None:
+        with pytest.raises(ValueError, match="only allowed when map is True or list"):
+            func("x", on_fail=lambda _: fastnumbers.SKIP)
+
+    @parametrize("func", get_funcs(conversion_funcs), ids=conversion_funcs)
+    def test_not_allowed_from_batched_callable_without_map(
+        self, func: Callable[..., Any]
+    ) -> None:
+        with pytest.raises(ValueError, match="only allowed when map is True or list"):
+            func(
+                "x",
+                on_fail=lambda x: [fastnumbers.SKIP] * len(x),
+                batch_on_fail=True,
+            )
+
+
+class TestBatchedOnFail:
+    """A batched on_fail callable is given every failing input at once"""
+
+    @parametrize(
+        "func",
+        [
+            fastnumbers.try_real,
+            fastnumbers.try_float,
+            fastnumbers.try_int,
+            fastnumbers.try_forceint,
+        ],
+    )
+    def test_map_list_calls_callable_once(self, func: ConversionFuncs) -> None:
+        calls: list[list[Any]] = []
+
+        def fixer(x: list[Any]) -> list[int]:
+            calls.append(x)
+            return [len(y) for y in x]
+
+        given = ["5", "bad", "7", "worse"]
+        result = func(given, on_fail=fixer, batch_on_fail=True, map=list)
+        assert result == [5, 3, 7, 5]
+        assert calls == [["bad", "worse"]]
+
+    def test_map_list_calls_callable_in_chunks(self) -> None:
+        sizes: list[int] = []
+
+        def fixer(x: list[Any]) -> list[int]:
+            sizes.append(len(x))
+            return [-1] * len(x)
+
+        given = ["x" if i % 2 else str(i) for i in range(5000)]
+        result = fastnumbers.try_int(
+            given, on_fail=fixer, batch_on_fail=True, map=list
+        )
+        assert result == [-1 if i % 2 else i for i in range(5000)]
+        assert sizes == [1024, 1024, 452]
+
+    def test_callable_not_called_without_failures(self) -> None:
+        def fixer(_: list[Any]) -> list[Any]:
+            raise AssertionError
+
+        result = fastnumbers.try_float(
+            ["1", "2"], on_fail=fixer, batch_on_fail=True, map=list
+        )
+        assert result == [1.0, 2.0]
+
+    def test_type_errors_are_not_batched(self) -> None:
+        result = fastnumbers.try_int(
+            ["x", None],
+            on_fail=lambda x: [9] * len(x),
+            on_type_error=lambda x: 8,
+            batch_on_fail=True,
+            map=list,
+        )
+        assert result == [9, 8]
+
+    def test_scalar_and_iterator_use_single_element_lists(self) -> None:
+        def fixer(x: list[Any]) -> list[Any]:
+            assert len(x) == 1
+            return x[::-1]
+
+        kwargs: dict[str, Any] = {"on_fail": fixer, "batch_on_fail": True}
+        assert fastnumbers.try_real("bad", **kwargs) == "bad"
+        assert list(fastnumbers.try_real(["1", "x"], map=True, **kwargs)) == [1, "x"]
+
+    def test_length_mismatch_raises(self) -> None:
+        kwargs: dict[str, Any] = {"on_fail": lambda _: [], "batch_on_fail": True}
+        match = "returned 0 replacements for 1 inputs"
+        with pytest.raises(ValueError, match=match):
+            fastnumbers.try_float("x", **kwargs)
+        with pytest.raises(ValueError, match=match):
+            fastnumbers.try_float(["x"], map=list, **kwargs)
+        with pytest.raises(ValueError, match=match):
+            list(fastnumbers.try_float(["x"], map=True, **kwargs))
+
+    def test_non_sequence_return_raises(self) -> None:
+        with pytest.raises(TypeError, match="must return a sequence"):
+            fastnumbers.try_float(
+                ["x"], on_fail=lambda _: 5, batch_on_fail=True, map=list
+            )
+
+
+class TestThreads:
+    """Ensure concurrent use of the functions gives the same answers"""
+
+    def test_concurrent_calls_agree_with_serial_calls(self) -> None:
+        data = ["4", "4.5", "nan", "inf", "not a number", "-41053.543e34"] * 50
+        funcs: list[Callable[[Any], Any]] = [
+            fastnumbers.try_real,
+            fastnumbers.try_float,
+            fastnumbers.try_int,
+            partial(fastnumbers.try_float, inf=0.0, on_fail=-1.0),
+            partial(fastnumbers.try_int, base=16, on_fail=None),
+            fastnumbers.check_float,
+            partial(fastnumbers.check_int, consider=fastnumbers.STRING_ONLY),
+            fastnumbers.query_type,
+        ]
+
+        def run() -> list[list[Any]]:
+            return [[repr(func(x)) for x in data] for func in funcs]
+
+        expected = run()
+        with ThreadPoolExecutor(max_workers=8) as pool:
+            results = [pool.submit(run) for _ in range(16)]
+            for future in results:
+                assert future.result() == expected
+
+    def test_list_mutated_by_another_thread(self) -> None:
+        data = [str(i) for i in range(1000)]
+        stop = threading.Event()
+
+        def mutate() -> None:
+            while not stop.is_set():
+                del data[500:]
+                data.extend(str(i) for i in range(500, 1000))
+                data[::2] = reversed(data[::2])
+
+        def read() -> None:
+            for _ in range(50):
+                result = fastnumbers.try_float(data, map=list)
+                assert all(isinstance(x, float) for x in result)
+                assert len(result) >= 500
+                assert fastnumbers.all_float(data)
+                assert fastnumbers.first_invalid_index(data) == -1
+
+        mutator = threading.Thread(target=mutate)
+        mutator.start()
+        try:
+            with ThreadPoolExecutor(max_workers=4) as pool:
+                for future in [pool.submit(read) for _ in range(4)]:
+                    future.result()
+        finally:
+            stop.set()
+            mutator.join()
+
+    def test_list_shortened_while_converting(self) -> None:
+        data = ["1", "x", "2", "3"]
+
+        def shorten(_: str) -> float:
+            del data[2:]
+            return 0.0
+
+        assert fastnumbers.try_float(data, on_fail=shorten, map=list) == [1.0, 0.0]
+
+
+class TestBufferSlices:
+    """Buffers are parsed in place, so nothing past a slice may be read"""
+
+    funcs = conversion_funcs
+
+    @given(binary(), sampled_from([b"", b"0", b"9" * 20, b" 1", b"e5", b"_0", b"\0"]))
+    @example(b"1" * 19, b"1")
+    @example(b"1" * 40, b"99")
+    @example(b"  ", b"1")
+    @example(b"-", b"5")
+    @example(b"+-", b"5")
+    @example(b"0x", b"f")
+    @parametrize("func", get_funcs(funcs), ids=funcs)
+    def test_slice_is_parsed_like_bytes(
+        self, func: ConversionFuncs, data: bytes, following: bytes
+    ) -> None:
+        view = memoryview(data + following)[: len(data)]
+        assert func(view, on_fail=None) == func(data, on_fail=None)
+
+    def test_slice_with_underscores(self) -> None:
+        view = memoryview(b"1_000_0000")[:7]
+        assert fastnumbers.try_int(view, allow_underscores=True) == 10000
+
+    @parametrize("map_", [False, list])
+    def test_view_is_released_after_parsing(self, map_: Any) -> None:
+        data = bytearray(b"12 34")
+        with memoryview(data) as view:
+            given = view[:2] if map_ is False else [view[:2], view[3:]]
+            result = fastnumbers.try_int(given, map=map_)
+            del given
+        data.extend(b"5")  # Would fail if a view of the data was still held
+        assert result == (12 if map_ is False else [12, 34])
+
+    @pytest.mark.skipif(sys.version_info < (3, 12), reason="needs __buffer__")
+    def test_view_of_temporary_is_held_while_parsing(self) -> None:
+        class Temporary:
+            released = 0
+
+            def __buffer__(self, flags: int) -> memoryview:
+                return memoryview(bytes(b"12.5 "))
+
+            def __release_buffer__(self, view: memoryview) -> None:
+                self.released += 1
+
+        given = Temporary()
+        assert fastnumbers.try_float(given) == 12.5
+        assert fastnumbers.try_float([given] * 3, map=list) == [12.5] * 3
+        assert given.released == 4
+
+    def test_mmap_slices(self) -> None:
+        with mmap.mmap(-1, 16) as mapped:
+            mapped.write(b"3.25 17 -4e1")
+            with memoryview(mapped) as view:
+                slices = [view[:4], view[5:7], view[8:12]]
+                result = fastnumbers.try_real(slices, map=list)
+                del slices
+        assert result == [3.25, 17, -40]